@@ -34,6 +34,7 @@ COMMON_SRC = \
             drivers/light_led.c \
             drivers/mco.c \
             drivers/motor.c \
+            drivers/motor_latency.c \
             drivers/pinio.c \
             drivers/pin_pull_up_down.c \
             drivers/resource.c \
@@ -67,6 +68,7 @@ COMMON_SRC = \
             msp/msp_box.c \
             msp/msp_serial.c \
             scheduler/scheduler.c \
+            scheduler/scheduler_trace.c \
             sensors/adcinternal.c \
             sensors/battery.c \
             sensors/current.c \
@@ -74,6 +76,7 @@ COMMON_SRC = \
             target/config_helper.c \
             fc/init.c \
             fc/controlrate_profile.c \
+            drivers/accgyro/gyro_fifo.c \
             drivers/accgyro/gyro_sync.c \
             drivers/pwm_esc_detect.c \
             drivers/pwm_output.c \
@@ -130,11 +133,14 @@ COMMON_SRC = \
             sensors/boardalignment.c \
             sensors/compass.c \
             sensors/gyro.c \
+            sensors/gyro_fusion.c \
             sensors/gyro_init.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
             blackbox/blackbox_encoding.c \
             blackbox/blackbox_io.c \
+            blackbox/blackbox_ring.c \
+            blackbox/blackbox_stream.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
             cms/cms_menu_failsafe.c \
@@ -240,6 +246,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             drivers/accgyro/accgyro_spi_lsm6dso.c \
             drivers/accgyro/accgyro_spi_qmi8658.c \
             drivers/accgyro/accgyro_spi_sh3001.c \
+            drivers/accgyro/gyro_fifo.c \
             drivers/accgyro_legacy/accgyro_adxl345.c \
             drivers/accgyro_legacy/accgyro_bma280.c \
             drivers/accgyro_legacy/accgyro_l3g4200d.c \
@@ -253,6 +260,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             drivers/bus_spi.c \
             drivers/exti.c \
             drivers/io.c \
+            drivers/motor_latency.c \
             drivers/pwm_output.c \
             drivers/rcc.c \
             drivers/serial.c \
@@ -282,9 +290,11 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             rx/xbus.c \
             rx/fport.c \
             scheduler/scheduler.c \
+            scheduler/scheduler_trace.c \
             sensors/acceleration.c \
             sensors/boardalignment.c \
             sensors/gyro.c \
+            sensors/gyro_fusion.c \
             $(CMSIS_SRC) \
             $(DEVICE_STDPERIPH_SRC) \
 
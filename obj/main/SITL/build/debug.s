@@ -0,0 +1,259 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\212\360\211\366\001\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.68985b9bc2caa9b7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.5.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375`\020\f\225;"
+	.string	":l\230\02730\3604\007"
+	.string	""
+	.string	"\004"
+	.string	"\3053\020\301\0018\335\003"
+	.string	" \261"
+	.ascii	"\030k\273w\370\272\335&2\332\356&\203\265\277\205\326\346`\024"
+	.ascii	"\bD`F\377\373\277\264\235\222\fr\001\202\001b\001\272L\331\261"
+	.ascii	"\2054A;\236\b\317\330\352(e\307\027\336\314\fO\244;\224\035c"
+	.ascii	"\030#\324\223\035g0\3019W4\324\265\311\2163\b\203r\376H\270g"
+	.ascii	"lu\302\354X\303o\361\341\217\206\272\rX\202s\016I\350gl\305\\"
+	.ascii	"\3311\207*A@\016i(hlEX\331q\207\227b\304#\211\237\262c\017\377"
+	.ascii	"\204\364H\345\330\212\213\262\343\017\337j\227\2446\266\342\237"
+	.ascii	"\354\030\355\225\274\271$Q.;\006\361G\210\370%1\304/\240_\022"
+	.ascii	"E\360:\035\223P\204\222\035\217\310u:&\266\261}]\3311\t[<\317"
+	.ascii	"\224\216\355w\312\216K\314\202\341\231\324\261}B\331\261\tX?"
+	.ascii	"\327\3246\266\277&;>\321*\3165}\231\354\030\205*!\356I\370M\262"
+	.ascii	"\343\024\247\200\356I\306\330\372\257\354X\005)\037\376\311Y"
+	.ascii	"e\307+B\315\360O\237\262c\026\236\2148(\241?\312\216[l\232\341"
+	.ascii	"\240\206\354\330\272\240\354\330E&8\017\225';~a\351\315C\rk\214"
+	.ascii	"\255\313\0314\t\316M\to\214\255\237!\004)\316M\rq\214\255\207"
+	.ascii	")\324H\207\237\022\362\030[gbH\221\021?5\fr\350\220\017G%\004"
+	.ascii	"2\266o\210\b\tqT\303!c\273\226(\020\021O%,2\266)\024\371\201"
+	.ascii	"0\307\327\375\030!\013\243\013\030\034_G\216\264\016\305qpl?"
+	.ascii	";\276:\261{\307_\001\037\347\347<\235\267\363w>\317\313\375\236"
+	.ascii	"\347\363}\336\317\003\372@?\350\t\275\241?\364\211^\3213\372"
+	.ascii	"F\377\350!\275\244\237\364\225\336\322c\372L?\374M\337\351=="
+	.ascii	"\250\017\365\243\236\324\233\372S\237\352U=\253o\365\257\036"
+	.ascii	"\326\313\372Y_\353m=\256\317\365\273J|\257\367\365\300>\230\210"
+	.ascii	"DL\".\021\231\210MD'\"\0241\2128\205\204XeD\220\316\202AG\234"
+	.ascii	"$yqE*q\026\204c\022Q\n\234\205\341?\t\002\272 \024\023[\"\027"
+	.ascii	"\206:Q\t\021\fB1,\036\t\002\302 \246(;\016\3735#\013\305\372"
+	.ascii	"d\307b\274\316<\024k\223u\301u\020\223\035\217\335\322\035\304"
+	.ascii	"\256d\307d\264\340<\210\265\3311\200Xo\036\206a\301\262\3432"
+	.ascii	"WA\271\017\302X\331q\200UA\271\017a\241\262c\001\250\200hf\245"
+	.ascii	"\202v\320\206a\223\262\3433Q@\022\302D\331\361\200O@\022C\002"
+	.ascii	"\234\202s%\204s\262\343\002\232\202s%\206a\006.\001M\b\303\270"
+	.ascii	"d\307\007(\02111\fC\020)(wB\230\300QP\356\004V\260\350d\2011"
+	.ascii	"e\307\013\020\305\261\030bI\3311\203Bo-\204\270\201\240\031-"
+	.ascii	"\260\237\354\330\301\037\322\205\020?\230\003\272\300\020\364"
+	.ascii	"\004\347^`*\331q\004<F^\fu\277\262c\t_'\316\017\tu\023\344\004"
+	.ascii	"\345\374\3200UvL\341M\320\216#\"\225\035W`\243\035\3210\254F"
+	.ascii	"\3275\335k+\253\177\245\2527\253\372\324\024\\\215\232'\333\003"
+	.ascii	"\232cw=y'\312\232\233l\333\351\316\324zG\340\232\233l\333\351"
+	.ascii	"\316\324zWv\327\237o\375\245\254[\232\306V\222h\332\331\325\250"
+	.ascii	"\217G\252l\272\201jeW\255w\362\316\225u\333dw\347CY3\354\372"
+	.ascii	"x\344^Y\2675\006\331]\32555|y\352\331;y[\257\332d\267F\177\246"
+	.ascii	"^+U\004\027X\222\373W\226$\253\326;y\347zvO\237\312\252\033U"
+	.ascii	"U\275}n\232u\333\004.[\231\242Z%\327|\254\272QU\325\333\347\246"
+	.ascii	"Y\267\255\340j\336\271\262z%W\225u\333\002n\215\0177\204\320"
+	.ascii	"\200\263\201f#G\234\020\032h;\342\336t\240\325\370\001\004\355"
+	.ascii	"\303\202\313\243\007\334\017\264 <x\374@\003pw\272\226\247\251"
+	.ascii	"\267\217][O\236zv\375\217\003rA>\310\013\271!G\344\211|\2213"
+	.ascii	"rG\376\310#\271$\247\344\225\374\222crM>tN\336\311?9(\027\345"
+	.ascii	"\243\274\224\233rT\236\312W9+w\345\257<\226\313rZ^\313o9.\327"
+	.ascii	"\345\273\274\227\373r"
+	.string	"`\036\354\221|\222_\362L\276\311;y(\037\345\247<\225\267\362W>\313ky.\337\345\275\374\227\017\363b\236\314\227\3713\217\346\325\374\232o\363n\036NW\367\322\036\326h\t,\311.p\353u%\323\306kj\001\232\227n\215\352\322\227\246\250y\372\3062\022M}{\200F\325z$\331\005p\311.[I\256j\330\345\371\266\217\267\262\245\252\315\2566\177\353\271\242\344\330]w;\035\f\275w\354\272\333\215\001\331\324\275S\327v\001\306n\033\271\005\334\335\3564\315\256Yi\242\004\211\023n$o\300U\177i*\276\353N}\273\260[\206\222?\030\354\326f\357\334i\265\036\271\r\334\335\312n\322<\321\261\213\222\275\255\327\336\311\226\346.\325l\344\312\002\3116\262\367\333g*\276;U{Ze\327\236\336\373W\232\3354\365\247\273\351i\376\310u\223<\025\300][\267\356\272\221\250\336\354Yv\267\356\235\351.\311"
+	.ascii	"7\300U\325\024eQ\262\247v\232]\275\222{mMS\236\312\226\233\300"
+	.ascii	"\005\256g\fr\253\261\347\332#\003\364\200\346\310\373\355"
+	.string	"\225M\373\316.p\257\232\247Q\275\032\270[\257\350\271\003p{'\257\227\236k\251\367NK\266$\005\334\222\034\273\246F\311\222E\311\2379\340\252;\335[\263<\337f\327tM5\007\\\266\336\211\372~\016\356n\363-\270\275\266\324d\325\362\\\325\223\255w\242\354N\335%\203\233n2\r_\363\364\005\200\327\250A8\202(\245D*H\n\n\n\222\264\031\300\"!\0222\017\021\340\224b\221\334\325\236\001j\2539A\033B\201\006\001\265\020\341B\024\0042\341\b\302\223\321\262\274\204\t\362\321L\344\275<\013em\263\251\032$\350%_\210\260\226P\264z,\022N\001^\247Q{\022\265\302\275h\324\303s\364\257)\320\273\253\267\272\2306\2429\362\310A3\033\243|\327\227\227\247\021\347\344C`/\013\006\bn\373S\032l\252\026W\365Z\356T\305\252\001\n>\016\221\312\2567\320\217\300\240\256D\210\270S\177\272\230"
+	.string	"\216}\205\020\247\220\273;\353]yr\032\\`6B[\036\365m\001ej\366\016`\356\303/\250\007lo7\236 \023V\240\203\273\177\350\230\337\316\311h"
+	.string	"\351\313\350\366_su:)7\306@\331\361\332\266\006\013\004\b)^|\344\302\314\221\373\370\260\224k\342B%A\311\327}\200;\271{L\210X\256\037\034R\201\214\251'}\300\237\301\261.1RF\311\242\371\202\354\250\250!\255Y4\367#\257Ngl\f\005\324\250\260l\322D\214c\033\013\204\032C,\202\353\354~\314oZ|\335\370\303\336M\337\260\257 Hcz1\204\340\263\357!.\"^\034GZ\264\232h\350@A\315i\357M\032>\244\3467<\317\222\204/\001\303\311\211\311\352mT\357\224x"
+	.ascii	"mR\237\277\374\267m\212\324\231\216\312>Qq\n\202*B\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\004\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\003\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.68985b9bc2caa9b7,"e",@progbits
+	.string	"(\265/\375`\003\n\375/"
+	.string	"\332Y\310\022C`\234Nc\277.\260Q\250r\266S!\333h\271L0\002,V\350c\257<c\016 ,-\016P\356\246\177g\322t\332T\237\316\036\374o\360\213\213\355\353\377c\252\037\313N\314P\032\203\211&o\245\225)\005\352"
+	.string	"#\001!\001\353Z\340\007\nG'h\257\375+w\333I*\233\320 cY\224\226\023\250\231\217\234\240\024){\317v+~\333\327\234\201\203w\222\324V\263u]\337\266\241\271\256Jo3\016\256\253\222\361w\360;\270dX]o\351\265\206\341\241\252_\305~\332\325\216\351\222\t]\335\326u5\356\220U)\264\263\327\320#\323a\333\217\251\177f\002j+\007\007\r\037\254G\246\027\372cj;\264\215\305~\t\373$\354\217\260/\302~\b\373 \354\177\260\357\301\376\006\373\032\354_\260o\301>\005\373\021\354C\260\337\300>\003\373\t\354#\260O\300>\322\276"
+	.string	"\373A\366\177\354\023\355\367\330O\355\337\276m\013\332\256c\033\320\366\237\355>\333nl\247\261\315g;\3176\236\355\t\366\247l\327\331\236\263\rg{\3076\235m\033\215F\243\266\327l\357\260}\276\002o\366\006\371\365Y7Xs\203\366\372}\366\333\334\315\333X\300\335\3659\331{\003kT\237\315\260\0316\005\313\336\002j\322\374\254wZx\366\372i\354\357\235o\311*\2170\373\354\265\337\221iQO\365\321\330.7::{\201\316\344\241\321:+c\257\237g\337\314\361\336\306b]\341|\254\242\216\340\331\373"
+	.string	"?\246\267S\375\273\264\220\216\0207{\215?vA{\227\327=h]\235eP\326%\263\002\2002r\316%{\375:2o\256\253[\021\212M\214\312\336\203y\230\243\t]\214?\346t\346Q\202\256\320\303a\322\303\311\336"
+	.string	"G\2466\307\220\307\272F\243\027J\357E\365\277\204\330r\222\331\273cch?\316\316\300\341h\217\373\234\201\020_f~\3532L\205T\257\013\260\314\336k\371\226\243)\270\034\324\bT8V(c\350+H\037\275\202\324*\206\376\330_\206\366\262\303\371$\327\365\tC\241\322\353M\340\272\254\2520\344k\346\335a\351\241R\002\305\204\022\231\311,g\366\372o\366\315N\345W~\232\353\272\264\006\266i[\246\265\302Sz>\355}\033\3256\311\017\227'50Hl\325\032\245^\234\275\266U\266\245\262G\354\223!\3177{\177\200\251\332N\371h)\263s\332+d\244\bOZR\316\233\275\266El\333\303J=\245\240\334\216L\237\246\332F\031\363\264"
+	.string	"rA=\r\2130\245M\331k\373d\333\245u\002\252\372rf\331\353\273#\323\037\"\252m\023\317\024\335\325\226\275D;\304*\201"
+	.string	"\325`Y\245m\203X!\311%%`\366b82M\177L\037Um\201\3609\311I%\1770-\3110\331k\373\303\266L\326G\032\355\372S\332\353-G\246"
+	.ascii	"~Lm\017\325v\211\270\024\365\306e\257\217U\262I\304=+d\256\330"
+	.ascii	"k\233d?j\327\237\270:6-{%\034\231\362\020\252~\341u\312i\372"
+	.ascii	"\262\367\016\n\222e9\177\330\353\013\332\247\363:\3044\273\301"
+	.ascii	"1{\017\345\310\224\300\034\325\0174\"\341Jb\332\213\224\003x"
+	.ascii	"\331\330\274\226\366\372\200\366\343\374\257h\245\246\306\264"
+	.ascii	"\367\313#S\001oT\037N\321i\214-H+:\250H5\212zx\220V|@\252Q\204"
+	.ascii	"\243\307\307B6\262At4\204ddt4D<j!\343\305\265\252\226h\220\002"
+	.ascii	"\205\211\341\213\013C0f\024\341p1T\243\250\005\215\241\027G7"
+	.ascii	"\206.\030\270AD\243\005\n\"\030F'b\340pA\004\243\270V\205\352"
+	.ascii	"*+\210%\264jkqL\236~\366682\r\212\265Lc\241\366\355,\032\235"
+	.ascii	"\230\274\300=\325\366l\030\215riB\305L\213\355M\312^[3\373z\266"
+	.ascii	"LG\224p\216\275\346[\252\266de\276\370\241\215\211\255p\362\262"
+	.ascii	"bm,\b\237\b\261\263\327\206\251\266S\026d\361\"go\217\024\260"
+	.ascii	"\"\037\025\330\237\275\266`\266\375\262Q\212c\262\300\020\261"
+	.ascii	"\367\315#\323\001PT[/\"\026:\302.{\217\266\313r\2455A\201\331"
+	.ascii	"k\313e[\"\366I\006e\223%\366:\f\223j\353$\025K\n\222m=\361\234"
+	.ascii	"sz\366\332>\355\277\261M\212waah\354}\322\214j\313\004@\234_"
+	.ascii	"Y\323\022\255\301\277@:\366\332j\331\326i\263\210@\360\002\243"
+	.ascii	"\354}\002%\252-V\317\363\212\312\226\275\b\354\225m6\233V{\366"
+	.ascii	":\200\260\250!0f\f4\314\023\021\031EI\222\341\260\002\021\261"
+	.ascii	"\032\267\001\021P!\203D\320et\353\006\305c\277\342Z\366\246\031"
+	.ascii	"9\354\324\f\034=\351\264\\\032\222\022\004g+\353n\244\373\303"
+	.ascii	"7\360\004%;\262\215\355\213\200j\356\376\025q\005\355Y\270B0"
+	.ascii	"J`\374<Wt\036\337D\016c\371x\312]x\272\345\023\022\344@\332`"
+	.ascii	"\203\271\223P\001\037\250\253B\302sAbi\277+\342\223-a/Z\206\373"
+	.ascii	"\361c\b\330\261,\036\224\001\217\322\342\347\206\347\320wl#\200"
+	.ascii	"\263\216*q\004\003z/\315\322\313\224\033G\2223\315\321\327:d"
+	.ascii	"\"%8\032\233j\313\272\336\241J-6\033\224\262(\213\256y9~1\326"
+	.ascii	"\331A\016D\300H\001G\316S?[!)\177\344i?zZ\320\206\206,\236\036"
+	.ascii	"\"l\023\224\001\273\214P\217\005\351\301\b\336\251D\212\303i"
+	.ascii	"s\330ea\202\352\016\343\263yN\247M6Aq\3356M\213\002\214>\n\233"
+	.ascii	"\276|S\204dr\002o\252\005\220\2706\320F\366[\005\373Xy\302Gz"
+	.ascii	"!\006\225\240\275>[\241U$4T\321K\217\273\357_GI:\315Er\037\200"
+	.ascii	"_|\325P!\305\007\272\301\250\225w\030U"
+	.text
+	.section	.gnu.lto_.symtab.68985b9bc2caa9b7,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.68985b9bc2caa9b7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
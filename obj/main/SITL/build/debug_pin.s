@@ -0,0 +1,242 @@
+	.file	"debug_pin.c"
+	.section	.gnu.lto_.profile.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\274\205\242\255\006"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\001"
+	.string	"\002\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002"
+	.string	")\301l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\002\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002\001\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.4bee4b5b28adedca,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dbgPinInit.3.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \300m\005"
+	.string	"T\tf"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\351\f\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\026\307\207\213\003\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \244\003\001\200\300\013/root/repo"
+	.string	"\035./src/main/build/debug_pin.c"
+	.string	"\b"
+	.ascii	"3\003\316\231!\340\313]\303\273B\030/C\204\313\261h'\031"
+	.text
+	.section	.gnu.lto_dbgPinHi.4.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\262\f/3`o\032\003T\ta\3400zGp7\261%\341J\200\022\351\257\233\217\215\035\302Z\325\266^\206\330\3557\b\"\322\331\025\302\270\313$\342fc\333rK\231R\022\227\205IX\216\006\223\235\205\006\317\346\262\242\345 =\233\210I\206\207\310\321 \242\206\240Y\347\322bD\226i\261\332\356'jf\342Q\264\333\307=\216\326\322\377\367\211Z\227\2001b\031h\371/^\\\256\002Q@\252\266v\255C,2=\322\224R\377\306\307\311\377\203\032"
+	.string	"\030f,0\031J\016\230\f;\333\025o\036w\211E\205\311\350\177|\035\236v\2636\211)P\350c\207Q\370_\007\ne\270\317m\013\332\"\264\325\b\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_dbgPinLo.5.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \363\235\006"
+	.string	"\262\214.2pO\032\003$\372\260]\340\026(f\257\341s\236\205\277\037\232b-\"\364\t\3216d\033\b\n{c\253j\354k\257\2603O\252t\373\375\266\345\2262\245\023\227\205IX\r\006\223\033\006\007N\346\262\242\365 9\231\210\311\006\210\250\321\"\"\246\240\331\346\322\242D\226i\221\332\356\007jE\361*\332\255\343\336F\353\350\377\373@\255Sx\250\205`\345\277xq\271\nD\371\240\332\332\265\016\261\310\364HS:\375\032\036'\377\021z\020`Xy@2\214, \031v\266,\336:\356\022\020\013\223\320\377\3708<\355fm\022O\236O\307\016`\341\177\235\347\203\341>\2675h\233\3206#\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\001\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\002\005\177\003"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4bee4b5b28adedca,"e",@progbits
+	.string	"(\265/\375`b\002E\024"
+	.string	"ff\210J\340\3208c\360["
+	.string	"\351^ \3163\300<\n\223t\031{[\004\236\234;\2212\200\243\264/\n\210\013\327\250s7S\023\245y\034\177\376\310W\236\214\004C\205aU\021\204\313r\360\315\251\360\230\260\370\212\347J%]\030\364\211L\001f"
+	.string	"p"
+	.string	"t"
+	.string	"\227\367\020\226'\352\330>\223\375#\277\277\371\213\366\274\377\342\177\220\323v\177\017\245\362f\232\177\215\200y\233\030$\373?\037\032@h\271\346\244\250\240\335z{\315\025m9K\177;\221z\206\253\210\342\263\377\366FxCol|\240\371\331V\203\265\255h{g{\265}mC\260\r\3036\330\353\365z\266]l\337\330\037\206:7}U\1772\3757\376\036-\235T\321\360\216E\345MO\323\357x\236LE{\365,}F\321T\256\252h*\257\212\236\274hKR\367\222LQS\356\252g\271\216h\251\\U\364\246b(\306\201\222<\315\264\215g\211W\336\364D\277\365\221\3754\371m\351I4\342X\240\030\217\026[1\246\366\376/`\306r\322\223\274\022\227\376\270\030\205\177E\f"
+	.string	"\300\016A;B\037h;\206\266;\226\307\266\307\236\260=\366\332\332\305\243\021\0203dE:^\263\235\210\3146\270had{m\025\026\327\b\371y\376\223x\f\341F\374|\240m\302\254\241\237\305*\241\021\204\366\307\307\363?\007\217\3733\026\362a=\254=\261E,\311\232\234\344\001\367b\016GH\202\305\370\341+\271e\376\021\375\375i2\331\254*\372\353p\276\006\257\006-\227\320\006\374\222Y\301N3\257\027\354$\300(\224\202\222\b\016\026\2040(\256\226\214\004\026\315\313*\346\024S\241E\363rr\265&X8\301\300.\234PHfZ.\006\256\326\003\326KL"
+	.ascii	"\303\264`+\327\212\025z%\225 \325\222\001\304-\252\024U\312\207"
+	.ascii	"[T(\224*\205\n\235B\221\274\333\355\324\324r \215&\204\263\321"
+	.ascii	"\351\354J\222a\326\324rV\304\232#\207Ma\273~;\216~J|\240\215"
+	.ascii	"\374\302v+ \200\002\221\272\323\001D\306\036\003\2225\354\220"
+	.ascii	"\245|#4\302x(\201E\204ype\241i,-\017ycs\330\n\277\202\333\034"
+	.ascii	"\214\301J\255r%\305*\247\214\216bR\240\275\224\205(3\204\263"
+	.ascii	"!\226\341T\003I\323\030\364P\361\222\035\357^\312\346\246\215"
+	.ascii	"k\273\341\206\027\314~\313+|\235~\335\031[\361\030"
+	.text
+	.section	.gnu.lto_.symtab.4bee4b5b28adedca,"e",@progbits
+	.string	"dbgPinInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	"dbgPinHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304"
+	.string	""
+	.string	""
+	.string	"dbgPinLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4bee4b5b28adedca,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
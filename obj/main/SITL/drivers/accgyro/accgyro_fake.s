@@ -0,0 +1 @@
+	.file	"accgyro_fake.c"
@@ -0,0 +1 @@
+	.file	"barometer_fake.c"
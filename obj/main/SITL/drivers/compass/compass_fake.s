@@ -0,0 +1 @@
+	.file	"compass_fake.c"
@@ -0,0 +1 @@
+	.file	"serial_tcp.c"
@@ -31,6 +31,7 @@
 #include "blackbox_encoding.h"
 #include "blackbox_fielddefs.h"
 #include "blackbox_io.h"
+#include "blackbox_ring.h"
 
 #include "build/build_config.h"
 #include "build/debug.h"
@@ -89,18 +90,26 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 6);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .sample_rate = BLACKBOX_RATE_QUARTER,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .fields_disabled_mask = 0, // default log all fields
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .compression = BLACKBOX_COMPRESSION_NONE,
+    .adaptive_predictor = false,
+    .trigger_history = 2,
+    .trigger_duration = 5,
+    .serial_framing = false,
+    .serial_flow_control = false,
 );
 
 STATIC_ASSERT((sizeof(blackboxConfig()->fields_disabled_mask) * 8) >= FLIGHT_LOG_FIELD_SELECT_COUNT, too_many_flight_log_fields_selections);
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
+// Longest time spent writing out a triggered incident after logging has been stopped
+#define BLACKBOX_RING_SHUTDOWN_TIMEOUT_MILLIS 5000
 
 // Some macros to make writing FLIGHT_LOG_FIELD_* constants shorter:
 
@@ -111,10 +120,17 @@ STATIC_ASSERT((sizeof(blackboxConfig()->fields_disabled_mask) * 8) >= FLIGHT_LOG
 #define UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED
 #define SIGNED FLIGHT_LOG_FIELD_SIGNED
 
+#define BLACKBOX_HEADER_PRODUCT "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+
 static const char blackboxHeader[] =
-    "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+    BLACKBOX_HEADER_PRODUCT
     "H Data version:2\n";
 
+// Version 3 logs may contain Huffman compressed frames (see blackboxFrameCommit()) and adaptive P frame predictors
+static const char blackboxHeaderV3[] =
+    BLACKBOX_HEADER_PRODUCT
+    "H Data version:3\n";
+
 static const char* const blackboxFieldHeaderNames[] = {
     "name",
     "signed",
@@ -398,6 +414,40 @@ static blackboxMainState_t* blackboxHistory[3];
 
 static bool blackboxModeActivationConditionPresent = false;
 
+#ifdef USE_BLACKBOX_RING
+/*
+ * In BLACKBOX_MODE_TRIGGERED the frames are captured in the RAM ring until a trigger fires. The ring is then trimmed
+ * to the configured history and drained to the device while new frames are still appended to it, and logging goes
+ * straight to the device once it is empty. Capture restarts when the trigger duration has passed.
+ */
+typedef enum {
+    BLACKBOX_RING_CAPTURING = 0,
+    BLACKBOX_RING_DRAINING,
+    BLACKBOX_RING_LIVE
+} blackboxRingState_e;
+
+static bool blackboxRingEnabled;
+static blackboxRingState_e blackboxRingState;
+static timeMs_t blackboxTriggerEndMs;
+static bool blackboxTriggerFired;
+static uint16_t blackboxTriggerFlightModeFlags;
+#endif
+
+/*
+ * Field groups whose P frame predictor is chosen per I frame interval when blackbox_adaptive_predictor is on. The
+ * choice for the following P frames is signalled at the start of each I frame, two bits per group.
+ */
+typedef enum {
+    ADAPTIVE_GROUP_GYRO = 0,
+    ADAPTIVE_GROUP_ACC,
+    ADAPTIVE_GROUP_DEBUG,
+    ADAPTIVE_GROUP_MOTOR,
+    ADAPTIVE_GROUP_COUNT
+} blackboxAdaptiveGroup_e;
+
+static bool blackboxAdaptivePredictorEnabled;
+static blackboxAdaptivePredictor_t blackboxAdaptivePredictor[ADAPTIVE_GROUP_COUNT];
+
 /**
  * Return true if it is safe to edit the Blackbox configuration.
  */
@@ -538,6 +588,13 @@ static void blackboxSetState(BlackboxState newState)
         break;
     case BLACKBOX_STATE_RUNNING:
         blackboxSlowFrameIterationTimer = blackboxSInterval; //Force a slow frame to be written on the first iteration
+#ifdef USE_BLACKBOX_RING
+        if (blackboxRingEnabled) {
+            blackboxRingReset();
+            blackboxRingSetCapture(true);
+            blackboxRingState = BLACKBOX_RING_CAPTURING;
+        }
+#endif
         break;
     case BLACKBOX_STATE_SHUTTING_DOWN:
         xmitState.u.startTime = millis();
@@ -552,7 +609,15 @@ static void writeIntraframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
-    blackboxWrite('I');
+    blackboxFrameBegin('I');
+
+    if (blackboxAdaptivePredictorEnabled) {
+        uint32_t predictors = 0;
+        for (int group = 0; group < ADAPTIVE_GROUP_COUNT; group++) {
+            predictors |= blackboxAdaptivePredictorSelect(&blackboxAdaptivePredictor[group]) << (2 * group);
+        }
+        blackboxWriteUnsignedVB(predictors);
+    }
 
     blackboxWriteUnsignedVB(blackboxIteration);
     blackboxWriteUnsignedVB(blackboxCurrent->time);
@@ -652,6 +717,8 @@ static void writeIntraframe(void)
         }
     }
 
+    blackboxFrameCommit();
+
     //Rotate our history buffers:
 
     //The current state becomes the new "before" state
@@ -678,12 +745,26 @@ static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHist
     }
 }
 
+static void blackboxWriteMainStateArrayUsingAdaptivePredictor(blackboxAdaptiveGroup_e group, int arrOffsetInHistory, int count)
+{
+    if (!blackboxAdaptivePredictorEnabled) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(arrOffsetInHistory, count);
+        return;
+    }
+
+    const int16_t *curr  = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
+    const int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
+    const int16_t *prev2 = (int16_t*) ((char*) (blackboxHistory[2]) + arrOffsetInHistory);
+
+    blackboxWriteArrayUsingAdaptivePredictor(&blackboxAdaptivePredictor[group], curr, prev1, prev2, count);
+}
+
 static void writeInterframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
 
-    blackboxWrite('P');
+    blackboxFrameBegin('P');
 
     //No need to store iteration count since its delta is always 1
 
@@ -774,25 +855,28 @@ static void writeInterframe(void)
 
     blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
 
-    //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
+    //Since gyros, accs and motors are noisy, base their predictions on the average of the history, or on whichever
+    //predictor did best over the last I frame interval when adaptive prediction is enabled:
     if (testBlackboxCondition(CONDITION(GYRO))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+        blackboxWriteMainStateArrayUsingAdaptivePredictor(ADAPTIVE_GROUP_GYRO, offsetof(blackboxMainState_t, gyroADC), XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(CONDITION(ACC))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
+        blackboxWriteMainStateArrayUsingAdaptivePredictor(ADAPTIVE_GROUP_ACC, offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(CONDITION(DEBUG_LOG))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+        blackboxWriteMainStateArrayUsingAdaptivePredictor(ADAPTIVE_GROUP_DEBUG, offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
     }
 
     if (isFieldEnabled(FIELD_SELECT(MOTOR))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+        blackboxWriteMainStateArrayUsingAdaptivePredictor(ADAPTIVE_GROUP_MOTOR, offsetof(blackboxMainState_t, motor), getMotorCount());
 
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
             blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
         }
     }
 
+    blackboxFrameCommit();
+
     //Rotate our history buffers
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
@@ -807,7 +891,7 @@ static void writeSlowFrame(void)
 {
     int32_t values[3];
 
-    blackboxWrite('S');
+    blackboxFrameBegin('S');
 
     blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
     blackboxWriteUnsignedVB(slowHistory.stateFlags);
@@ -820,6 +904,8 @@ static void writeSlowFrame(void)
     values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
     blackboxWriteTag2_3S32(values);
 
+    blackboxFrameCommit();
+
     blackboxSlowFrameIterationTimer = 0;
 }
 
@@ -884,6 +970,15 @@ void blackboxValidateConfig(void)
     default:
         blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
     }
+
+#ifndef USE_HUFFMAN
+    blackboxConfigMutable()->compression = BLACKBOX_COMPRESSION_NONE;
+#endif
+#ifndef USE_BLACKBOX_RING
+    if (blackboxConfig()->mode == BLACKBOX_MODE_TRIGGERED) {
+        blackboxConfigMutable()->mode = BLACKBOX_MODE_NORMAL;
+    }
+#endif
 }
 
 static void blackboxResetIterationTimers(void)
@@ -909,6 +1004,8 @@ static void blackboxStart(void)
 
     memset(&gpsHistory, 0, sizeof(gpsHistory));
 
+    blackboxResetStats();
+
     blackboxHistory[0] = &blackboxHistoryRing[0];
     blackboxHistory[1] = &blackboxHistoryRing[1];
     blackboxHistory[2] = &blackboxHistoryRing[2];
@@ -926,6 +1023,20 @@ static void blackboxStart(void)
 
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
+#ifdef USE_BLACKBOX_RING
+    blackboxRingEnabled = blackboxConfig()->mode == BLACKBOX_MODE_TRIGGERED;
+    blackboxRingSetCapture(false);
+    blackboxTriggerFired = false;
+    blackboxTriggerFlightModeFlags = flightModeFlags;
+#endif
+
+    // The header must agree with the frames, so the compression setting is also fixed for the duration of the log
+    blackboxFrameSetCompression(blackboxConfig()->compression == BLACKBOX_COMPRESSION_HUFFMAN);
+    blackboxAdaptivePredictorEnabled = blackboxConfig()->adaptive_predictor;
+    for (int group = 0; group < ADAPTIVE_GROUP_COUNT; group++) {
+        blackboxAdaptivePredictorInit(&blackboxAdaptivePredictor[group]);
+    }
+
     blackboxResetIterationTimers();
 
     /*
@@ -951,6 +1062,12 @@ void blackboxFinish(void)
         break;
     case BLACKBOX_STATE_RUNNING:
     case BLACKBOX_STATE_PAUSED:
+#ifdef USE_BLACKBOX_RING
+        if (blackboxRingEnabled && blackboxRingState == BLACKBOX_RING_CAPTURING) {
+            // Nothing has happened since the last incident, so the history is not wanted
+            blackboxRingSetCapture(false);
+        }
+#endif
         blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
         FALLTHROUGH;
     default:
@@ -1010,19 +1127,21 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
-    blackboxWrite('H');
+    blackboxFrameBegin('H');
 
     blackboxWriteSignedVB(GPS_home[0]);
     blackboxWriteSignedVB(GPS_home[1]);
     //TODO it'd be great if we could grab the GPS current time and write that too
 
+    blackboxFrameCommit();
+
     gpsHistory.GPS_home[0] = GPS_home[0];
     gpsHistory.GPS_home[1] = GPS_home[1];
 }
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
-    blackboxWrite('G');
+    blackboxFrameBegin('G');
 
     /*
      * If we're logging every frame, then a GPS frame always appears just after a frame with the
@@ -1042,6 +1161,8 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
     blackboxWriteUnsignedVB(gpsSol.groundSpeed);
     blackboxWriteUnsignedVB(gpsSol.groundCourse);
 
+    blackboxFrameCommit();
+
     gpsHistory.GPS_numSat = gpsSol.numSat;
     gpsHistory.GPS_coord[GPS_LATITUDE] = gpsSol.llh.lat;
     gpsHistory.GPS_coord[GPS_LONGITUDE] = gpsSol.llh.lon;
@@ -1290,6 +1411,7 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("I interval", "%d",                      blackboxIInterval);
         BLACKBOX_PRINT_HEADER_LINE("P interval", "%d",                      blackboxPInterval);
         BLACKBOX_PRINT_HEADER_LINE("P ratio", "%d",                         (uint16_t)(blackboxIInterval / blackboxPInterval));
+        BLACKBOX_PRINT_HEADER_LINE("P adaptive predictor", "%d",            blackboxAdaptivePredictorEnabled);
         BLACKBOX_PRINT_HEADER_LINE("minthrottle", "%d",                     motorConfig()->minthrottle);
         BLACKBOX_PRINT_HEADER_LINE("maxthrottle", "%d",                     motorConfig()->maxthrottle);
         BLACKBOX_PRINT_HEADER_LINE("gyro_scale","0x%x",                     castFloatBytesToInt(1.0f));
@@ -1420,6 +1542,9 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("gyro_notch_cutoff", "%d,%d",            gyroConfig()->gyro_soft_notch_cutoff_1,
                                                                             gyroConfig()->gyro_soft_notch_cutoff_2);
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_GYRO_TO_USE, "%d",            gyroConfig()->gyro_to_use);
+#ifdef USE_MULTI_GYRO
+        BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_GYRO_FUSION_OUTLIER_DPS, "%d", gyroConfig()->gyro_fusion_outlier_dps);
+#endif
 #ifdef USE_DYN_NOTCH_FILTER
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_DYN_NOTCH_MAX_HZ, "%d",       dynNotchConfig()->dyn_notch_max_hz);
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_DYN_NOTCH_COUNT, "%d",        dynNotchConfig()->dyn_notch_count);
@@ -1529,8 +1654,8 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
     }
 
     //Shared header for event frames
-    blackboxWrite('E');
-    blackboxWrite(event);
+    blackboxFrameBegin('E');
+    blackboxWriteU8(event);
 
     //Now serialize the data for this specific frame type
     switch (event) {
@@ -1558,12 +1683,29 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
         blackboxWriteUnsignedVB(data->loggingResume.currentTime);
         break;
     case FLIGHT_LOG_EVENT_LOG_END:
-        blackboxWriteString("End of log");
-        blackboxWrite(0);
+        for (const char *c = "End of log"; ; c++) {
+            blackboxWriteU8(*c);
+            if (*c == '\0') {
+                break;
+            }
+        }
         break;
     default:
         break;
     }
+
+    blackboxFrameCommit();
+}
+
+// Write a log entry so the decoder is aware that the large time/iteration skip before the next I frame is intended
+static void blackboxLogResumeEvent(timeUs_t currentTimeUs)
+{
+    flightLogEvent_loggingResume_t resume;
+
+    resume.logIteration = blackboxIteration;
+    resume.currentTime = currentTimeUs;
+
+    blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
 }
 
 /* If an arming beep has played since it was last logged, write the time of the arming beep to the log as a synchronization point */
@@ -1639,6 +1781,15 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
     // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
     if (blackboxShouldLogIFrame()) {
+#ifdef USE_BLACKBOX_RING
+        if (blackboxRingIsCapturing()) {
+            // Every I frame in the ring is a place where the log may start, which needs the resume event and slow state
+            blackboxRingMarkSyncPoint(currentTimeUs / 1000);
+            blackboxLogResumeEvent(currentTimeUs);
+            loadSlowState(&slowHistory);
+            writeSlowFrame();
+        } else
+#endif
         /*
          * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
          * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
@@ -1682,6 +1833,54 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
     blackboxDeviceFlush();
 }
 
+#ifdef USE_BLACKBOX_RING
+static bool blackboxTriggerActive(void)
+{
+    const bool flightModeChanged = flightModeFlags != blackboxTriggerFlightModeFlags;
+    blackboxTriggerFlightModeFlags = flightModeFlags;
+
+    return crashRecoveryModeActive()
+        || failsafeIsActive()
+        || gyroOverflowDetected()
+        || (blackboxModeActivationConditionPresent && IS_RC_MODE_ACTIVE(BOXBLACKBOX))
+        || flightModeChanged;
+}
+
+// Called once every FC loop in BLACKBOX_MODE_TRIGGERED, before the frames of the iteration are logged
+static void blackboxRingUpdate(timeUs_t currentTimeUs)
+{
+    const timeMs_t currentTimeMs = currentTimeUs / 1000;
+
+    if (blackboxTriggerActive()) {
+        if (blackboxRingState == BLACKBOX_RING_CAPTURING) {
+            blackboxRingTrim(currentTimeMs - blackboxConfig()->trigger_history * 1000);
+            blackboxRingState = BLACKBOX_RING_DRAINING;
+            blackboxTriggerFired = true;
+        }
+        blackboxTriggerEndMs = currentTimeMs + blackboxConfig()->trigger_duration * 1000;
+    }
+
+    switch (blackboxRingState) {
+    case BLACKBOX_RING_DRAINING:
+        if (blackboxDeviceWriteRing()) {
+            blackboxRingSetCapture(false);
+            blackboxRingState = BLACKBOX_RING_LIVE;
+        }
+        break;
+    case BLACKBOX_RING_LIVE:
+        if (cmp32(currentTimeMs, blackboxTriggerEndMs) >= 0) {
+            blackboxRingReset();
+            blackboxRingSetCapture(true);
+            blackboxRingState = BLACKBOX_RING_CAPTURING;
+        }
+        break;
+    case BLACKBOX_RING_CAPTURING:
+    default:
+        break;
+    }
+}
+#endif
+
 /**
  * Call each flight loop iteration to perform blackbox logging.
  */
@@ -1716,11 +1915,13 @@ void blackboxUpdate(timeUs_t currentTimeUs)
          */
         if (millis() > xmitState.u.startTime + 100) {
             if (blackboxDeviceReserveBufferSpace(BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION) == BLACKBOX_RESERVE_SUCCESS) {
-                for (int i = 0; i < BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION && blackboxHeader[xmitState.headerIndex] != '\0'; i++, xmitState.headerIndex++) {
-                    blackboxWrite(blackboxHeader[xmitState.headerIndex]);
+                const bool headerV3 = blackboxFrameCompressionEnabled() || blackboxAdaptivePredictorEnabled;
+                const char *header = headerV3 ? blackboxHeaderV3 : blackboxHeader;
+                for (int i = 0; i < BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION && header[xmitState.headerIndex] != '\0'; i++, xmitState.headerIndex++) {
+                    blackboxWrite(header[xmitState.headerIndex]);
                     blackboxHeaderBudget--;
                 }
-                if (blackboxHeader[xmitState.headerIndex] == '\0') {
+                if (header[xmitState.headerIndex] == '\0') {
                     blackboxSetState(BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER);
                 }
             }
@@ -1790,13 +1991,7 @@ void blackboxUpdate(timeUs_t currentTimeUs)
     case BLACKBOX_STATE_PAUSED:
         // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
         if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
-            // Write a log entry so the decoder is aware that our large time/iteration skip is intended
-            flightLogEvent_loggingResume_t resume;
-
-            resume.logIteration = blackboxIteration;
-            resume.currentTime = currentTimeUs;
-
-            blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+            blackboxLogResumeEvent(currentTimeUs);
             blackboxSetState(BLACKBOX_STATE_RUNNING);
 
             blackboxLogIteration(currentTimeUs);
@@ -1807,6 +2002,13 @@ void blackboxUpdate(timeUs_t currentTimeUs)
     case BLACKBOX_STATE_RUNNING:
         // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
         // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
+#ifdef USE_BLACKBOX_RING
+        // The mode switch is one of the triggers rather than a pause in BLACKBOX_MODE_TRIGGERED
+        if (blackboxRingEnabled) {
+            blackboxRingUpdate(currentTimeUs);
+            blackboxLogIteration(currentTimeUs);
+        } else
+#endif
         if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
             blackboxSetState(BLACKBOX_STATE_PAUSED);
         } else {
@@ -1822,6 +2024,21 @@ void blackboxUpdate(timeUs_t currentTimeUs)
          *
          * Don't wait longer than it could possibly take if something funky happens.
          */
+#ifdef USE_BLACKBOX_RING
+        if (blackboxRingIsCapturing()) {
+            // Finish writing out the incident, which ends with the log end event, before the log is closed
+            if (blackboxDeviceWriteRing() || millis() > xmitState.u.startTime + BLACKBOX_RING_SHUTDOWN_TIMEOUT_MILLIS) {
+                blackboxRingSetCapture(false);
+                xmitState.u.startTime = millis();
+            }
+            blackboxDeviceFlush();
+            break;
+        }
+        if (blackboxRingEnabled && !blackboxTriggerFired) {
+            // Only the header made it to the device
+            blackboxLoggedAnyFrames = false;
+        }
+#endif
         if (blackboxDeviceEndLog(blackboxLoggedAnyFrames) && (millis() > xmitState.u.startTime + BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS || blackboxDeviceFlushForce())) {
             blackboxDeviceClose();
             blackboxSetState(BLACKBOX_STATE_STOPPED);
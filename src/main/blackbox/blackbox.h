@@ -35,9 +35,15 @@ typedef enum BlackboxDevice {
 typedef enum BlackboxMode {
     BLACKBOX_MODE_NORMAL = 0,
     BLACKBOX_MODE_MOTOR_TEST,
-    BLACKBOX_MODE_ALWAYS_ON
+    BLACKBOX_MODE_ALWAYS_ON,
+    BLACKBOX_MODE_TRIGGERED
 } BlackboxMode;
 
+typedef enum BlackboxCompression {
+    BLACKBOX_COMPRESSION_NONE = 0,
+    BLACKBOX_COMPRESSION_HUFFMAN
+} BlackboxCompression_e;
+
 typedef enum BlackboxSampleRate { // Sample rate is 1/(2^BlackboxSampleRate)
     BLACKBOX_RATE_ONE = 0,
     BLACKBOX_RATE_HALF,
@@ -63,6 +69,12 @@ typedef struct blackboxConfig_s {
     uint8_t device;
     uint32_t fields_disabled_mask;
     uint8_t mode;
+    uint8_t compression;
+    uint8_t adaptive_predictor;
+    uint8_t trigger_history;    // seconds of history logged from before a trigger in BLACKBOX_MODE_TRIGGERED
+    uint8_t trigger_duration;   // seconds logged after the trigger condition clears
+    uint8_t serial_framing;     // send the serial log in packets with a sequence number and CRC (see blackbox_stream.h)
+    uint8_t serial_flow_control; // honour XON/XOFF from the recorder, framed serial log only
 } blackboxConfig_t;
 
 PG_DECLARE(blackboxConfig_t, blackboxConfig);
@@ -28,13 +28,122 @@
 
 #ifdef USE_BLACKBOX
 
+#include "blackbox.h"
 #include "blackbox_encoding.h"
+#include "blackbox_fielddefs.h"
 #include "blackbox_io.h"
 
 #include "common/encoding.h"
+#include "common/huffman.h"
 #include "common/printf.h"
+#include "common/utils.h"
 
 
+// Frame being assembled by blackboxFrameBegin(), NULL when encoding straight to the device
+static FAST_DATA_ZERO_INIT uint8_t *blackboxFramePtr;
+static FAST_DATA_ZERO_INIT bool blackboxFrameOverflow;
+static uint8_t blackboxFrameBuffer[BLACKBOX_FRAME_BUFFER_SIZE];
+
+#ifdef USE_HUFFMAN
+// Compressed frame header is the marker plus the uncompressed length, which needs at most two VB bytes
+#define BLACKBOX_COMPRESSED_HEADER_SIZE 3
+
+static FAST_DATA_ZERO_INIT bool blackboxFrameCompression;
+// The Huffman encoder may write up to one code (12 bits) past the limit it is given before it detects the overflow
+static uint8_t blackboxCompressedBuffer[BLACKBOX_COMPRESSED_HEADER_SIZE + BLACKBOX_FRAME_BUFFER_SIZE + 4];
+#endif
+
+static inline void blackboxEncodeByte(uint8_t value)
+{
+    if (blackboxFramePtr) {
+        if (blackboxFramePtr < &blackboxFrameBuffer[BLACKBOX_FRAME_BUFFER_SIZE]) {
+            *blackboxFramePtr++ = value;
+        } else {
+            blackboxFrameOverflow = true;
+        }
+    } else {
+        blackboxWrite(value);
+    }
+}
+
+/*
+ * Start assembling a frame of the given type in the frame buffer. Everything encoded until blackboxFrameCommit()
+ * is written to the device in a single operation rather than a byte at a time.
+ */
+void blackboxFrameBegin(uint8_t frameType)
+{
+    blackboxFramePtr = blackboxFrameBuffer;
+    blackboxFrameOverflow = false;
+    *blackboxFramePtr++ = frameType;
+}
+
+/*
+ * Write the assembled frame to the device. A frame that overflowed the buffer, or that does not fit in the device
+ * buffer, is dropped whole as a partial frame would desynchronise the decoder. Returns the number of bytes written.
+ */
+int blackboxFrameCommit(void)
+{
+    int length = blackboxFramePtr - blackboxFrameBuffer;
+    const uint8_t frameType = blackboxFrameBuffer[0];
+
+    blackboxFramePtr = NULL;
+
+    if (blackboxFrameOverflow) {
+        blackboxStatsRecordFrame(frameType, false);
+        return 0;
+    }
+
+#ifdef USE_HUFFMAN
+    if (blackboxFrameCompression) {
+        uint8_t *out = blackboxCompressedBuffer;
+        *out++ = BLACKBOX_FRAME_COMPRESSED;
+        for (uint32_t value = length; ; value >>= 7) {
+            if (value < 0x80) {
+                *out++ = value;
+                break;
+            }
+            *out++ = value | 0x80;
+        }
+        const int headerLength = out - blackboxCompressedBuffer;
+
+        // Only keep the compressed frame if it is smaller, otherwise the raw frame is written as usual
+        const int codedLength = huffmanEncodeBuf(out, length - headerLength, blackboxFrameBuffer, length, huffmanTable);
+        if (codedLength > 0 && headerLength + codedLength < length) {
+            length = headerLength + codedLength;
+            const bool logged = blackboxWriteBuf(blackboxCompressedBuffer, length);
+            blackboxStatsRecordFrame(frameType, logged);
+            return logged ? length : 0;
+        }
+    }
+#endif
+
+    const bool logged = blackboxWriteBuf(blackboxFrameBuffer, length);
+    blackboxStatsRecordFrame(frameType, logged);
+
+    return logged ? length : 0;
+}
+
+/*
+ * Compress frames committed from now on with the Huffman coder. The log header must announce version 3 when enabled.
+ */
+void blackboxFrameSetCompression(bool enabled)
+{
+#ifdef USE_HUFFMAN
+    blackboxFrameCompression = enabled;
+#else
+    UNUSED(enabled);
+#endif
+}
+
+bool blackboxFrameCompressionEnabled(void)
+{
+#ifdef USE_HUFFMAN
+    return blackboxFrameCompression;
+#else
+    return false;
+#endif
+}
+
 static void _putc(void *p, char c)
 {
     (void)p;
@@ -92,10 +201,10 @@ void blackboxWriteUnsignedVB(uint32_t value)
 {
     //While this isn't the final byte (we can only write 7 bits at a time)
     while (value > 127) {
-        blackboxWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
+        blackboxEncodeByte((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
         value >>= 7;
     }
-    blackboxWrite(value);
+    blackboxEncodeByte(value);
 }
 
 /**
@@ -123,8 +232,8 @@ void blackboxWriteSigned16VBArray(int16_t *array, int count)
 
 void blackboxWriteS16(int16_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
+    blackboxEncodeByte(value & 0xFF);
+    blackboxEncodeByte((value >> 8) & 0xFF);
 }
 
 /**
@@ -183,16 +292,16 @@ void blackboxWriteTag2_3S32(int32_t *values)
 
     switch (selector) {
     case BITS_2:
-        blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        blackboxEncodeByte((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
         break;
     case BITS_4:
-        blackboxWrite((selector << 6) | (values[0] & 0x0F));
-        blackboxWrite((values[1] << 4) | (values[2] & 0x0F));
+        blackboxEncodeByte((selector << 6) | (values[0] & 0x0F));
+        blackboxEncodeByte((values[1] << 4) | (values[2] & 0x0F));
         break;
     case BITS_6:
-        blackboxWrite((selector << 6) | (values[0] & 0x3F));
-        blackboxWrite((uint8_t)values[1]);
-        blackboxWrite((uint8_t)values[2]);
+        blackboxEncodeByte((selector << 6) | (values[0] & 0x3F));
+        blackboxEncodeByte((uint8_t)values[1]);
+        blackboxEncodeByte((uint8_t)values[2]);
         break;
     case BITS_32:
         /*
@@ -222,28 +331,28 @@ void blackboxWriteTag2_3S32(int32_t *values)
         }
 
         //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
+        blackboxEncodeByte((selector << 6) | selector2);
 
         //And now the values according to the selectors we picked for them
         for (int x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
             switch (selector2 & 0x03) {
             case BYTES_1:
-                blackboxWrite(values[x]);
+                blackboxEncodeByte(values[x]);
                 break;
             case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
                 break;
             case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
+                blackboxEncodeByte(values[x] >> 16);
                 break;
             case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
+                blackboxEncodeByte(values[x] >> 16);
+                blackboxEncodeByte(values[x] >> 24);
                 break;
             }
         }
@@ -304,18 +413,18 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
 
     switch (selector) {
     case BITS_2:
-        blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        blackboxEncodeByte((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
         break;
     case BITS_554:
         // 554 bits per field  ss11 1112 2222 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
-        blackboxWrite(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
+        blackboxEncodeByte((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
+        blackboxEncodeByte(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
         break;
     case BITS_877:
         // 877 bits per field  ss11 1111 1122 2222 2333 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0xFF) >> 2));
-        blackboxWrite(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
-        blackboxWrite(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
+        blackboxEncodeByte((selector << 6) | ((values[0] & 0xFF) >> 2));
+        blackboxEncodeByte(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
+        blackboxEncodeByte(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
         break;
     case BITS_32:
         /*
@@ -344,28 +453,28 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
         }
 
         //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
+        blackboxEncodeByte((selector << 6) | selector2);
 
         //And now the values according to the selectors we picked for them
         for (int x = 0; x < FIELD_COUNT; x++, selector2 >>= 2) {
             switch (selector2 & 0x03) {
             case BYTES_1:
-                blackboxWrite(values[x]);
+                blackboxEncodeByte(values[x]);
                 break;
             case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
                 break;
             case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
+                blackboxEncodeByte(values[x] >> 16);
                 break;
             case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
+                blackboxEncodeByte(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
+                blackboxEncodeByte(values[x] >> 16);
+                blackboxEncodeByte(values[x] >> 24);
                 break;
             }
         }
@@ -404,7 +513,7 @@ void blackboxWriteTag8_4S16(int32_t *values)
         }
     }
 
-    blackboxWrite(selector);
+    blackboxEncodeByte(selector);
 
     int nibbleIndex = 0;
     uint8_t buffer = 0;
@@ -419,16 +528,16 @@ void blackboxWriteTag8_4S16(int32_t *values)
                 buffer = values[x] << 4;
                 nibbleIndex = 1;
             } else {
-                blackboxWrite(buffer | (values[x] & 0x0F));
+                blackboxEncodeByte(buffer | (values[x] & 0x0F));
                 nibbleIndex = 0;
             }
             break;
         case FIELD_8BIT:
             if (nibbleIndex == 0) {
-                blackboxWrite(values[x]);
+                blackboxEncodeByte(values[x]);
             } else {
                 //Write the high bits of the value first (mask to avoid sign extension)
-                blackboxWrite(buffer | ((values[x] >> 4) & 0x0F));
+                blackboxEncodeByte(buffer | ((values[x] >> 4) & 0x0F));
                 //Now put the leftover low bits into the top of the next buffer entry
                 buffer = values[x] << 4;
             }
@@ -436,13 +545,13 @@ void blackboxWriteTag8_4S16(int32_t *values)
         case FIELD_16BIT:
             if (nibbleIndex == 0) {
                 //Write high byte first
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x]);
+                blackboxEncodeByte(values[x] >> 8);
+                blackboxEncodeByte(values[x]);
             } else {
                 //First write the highest 4 bits
-                blackboxWrite(buffer | ((values[x] >> 12) & 0x0F));
+                blackboxEncodeByte(buffer | ((values[x] >> 12) & 0x0F));
                 // Then the middle 8
-                blackboxWrite(values[x] >> 4);
+                blackboxEncodeByte(values[x] >> 4);
                 //Only the smallest 4 bits are still left to write
                 buffer = values[x] << 4;
             }
@@ -451,7 +560,7 @@ void blackboxWriteTag8_4S16(int32_t *values)
     }
     //Anything left over to write?
     if (nibbleIndex == 1) {
-        blackboxWrite(buffer);
+        blackboxEncodeByte(buffer);
     }
 }
 
@@ -482,7 +591,7 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
                 }
             }
 
-            blackboxWrite(header);
+            blackboxEncodeByte(header);
 
             for (int i = 0; i < valueCount; i++) {
                 if (values[i] != 0) {
@@ -494,12 +603,18 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
 }
 
 /** Write unsigned integer **/
+// Write a single byte, into the frame being assembled if there is one
+void blackboxWriteU8(uint8_t value)
+{
+    blackboxEncodeByte(value);
+}
+
 void blackboxWriteU32(int32_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
-    blackboxWrite((value >> 16) & 0xFF);
-    blackboxWrite((value >> 24) & 0xFF);
+    blackboxEncodeByte(value & 0xFF);
+    blackboxEncodeByte((value >> 8) & 0xFF);
+    blackboxEncodeByte((value >> 16) & 0xFF);
+    blackboxEncodeByte((value >> 24) & 0xFF);
 }
 
 /** Write float value in the integer form **/
@@ -507,4 +622,84 @@ void blackboxWriteFloat(float value)
 {
     blackboxWriteU32(castFloatBytesToInt(value));
 }
+
+// Candidates in order of preference when their costs are equal
+static const uint8_t blackboxAdaptivePredictors[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT] = {
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2,
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS,
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE,
+};
+
+void blackboxAdaptivePredictorInit(blackboxAdaptivePredictor_t *state)
+{
+    state->predictor = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2;
+    memset(state->cost, 0, sizeof(state->cost));
+}
+
+/*
+ * Close the current window: switch to the candidate whose residuals needed the fewest bits over it, unless the
+ * predictor in use was already as cheap. Returns the predictor to use for the next window.
+ */
+uint8_t blackboxAdaptivePredictorSelect(blackboxAdaptivePredictor_t *state)
+{
+    uint32_t currentCost = UINT32_MAX;
+    uint32_t bestCost = UINT32_MAX;
+    uint8_t best = state->predictor;
+
+    for (int i = 0; i < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; i++) {
+        if (blackboxAdaptivePredictors[i] == state->predictor) {
+            currentCost = state->cost[i];
+        }
+        if (state->cost[i] < bestCost) {
+            bestCost = state->cost[i];
+            best = blackboxAdaptivePredictors[i];
+        }
+    }
+    if (bestCost < currentCost) {
+        state->predictor = best;
+    }
+    memset(state->cost, 0, sizeof(state->cost));
+
+    return state->predictor;
+}
+
+int32_t blackboxAdaptivePredict(uint8_t predictor, int32_t prev1, int32_t prev2)
+{
+    switch (predictor) {
+    case FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS:
+        return prev1;
+    case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+        return 2 * prev1 - prev2;
+    case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+    default:
+        return (prev1 + prev2) / 2;
+    }
+}
+
+// Significant bits of the zig-zag encoded value, a finer grained measure than the VB byte count it determines
+static int blackboxSignedBitLength(int32_t value)
+{
+    return 32 - __builtin_clz(zigzagEncode(value) | 1);
+}
+
+/*
+ * Write each value as a signed VB difference from the prediction of the state's current predictor, while totalling
+ * what every candidate predictor would have cost so that the next window can use the cheapest one.
+ */
+void blackboxWriteArrayUsingAdaptivePredictor(blackboxAdaptivePredictor_t *state, const int16_t *curr, const int16_t *prev1, const int16_t *prev2, int count)
+{
+    for (int i = 0; i < count; i++) {
+        int32_t residual = 0;
+
+        for (int j = 0; j < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; j++) {
+            const int32_t delta = curr[i] - blackboxAdaptivePredict(blackboxAdaptivePredictors[j], prev1[i], prev2[i]);
+            state->cost[j] += blackboxSignedBitLength(delta);
+            if (blackboxAdaptivePredictors[j] == state->predictor) {
+                residual = delta;
+            }
+        }
+
+        blackboxWriteSignedVB(residual);
+    }
+}
 #endif // BLACKBOX
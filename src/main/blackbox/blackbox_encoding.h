@@ -20,6 +20,26 @@
 
 #pragma once
 
+// Largest frame that can be assembled by blackboxFrameBegin(), a full I frame with every field at its maximum
+// variable byte length is under 300 bytes
+#define BLACKBOX_FRAME_BUFFER_SIZE 384
+
+// Marker of a Huffman compressed frame, followed by the uncompressed length as an unsigned VB and the coded frame
+#define BLACKBOX_FRAME_COMPRESSED 'Z'
+
+// Number of candidate predictors considered by blackboxWriteArrayUsingAdaptivePredictor()
+#define BLACKBOX_ADAPTIVE_PREDICTOR_COUNT 3
+
+typedef struct blackboxAdaptivePredictor_s {
+    uint8_t predictor; // FLIGHT_LOG_FIELD_PREDICTOR_* used for the current window
+    uint32_t cost[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT]; // Residual bits of each candidate in the current window
+} blackboxAdaptivePredictor_t;
+
+void blackboxFrameBegin(uint8_t frameType);
+int blackboxFrameCommit(void);
+void blackboxFrameSetCompression(bool enabled);
+bool blackboxFrameCompressionEnabled(void);
+
 int blackboxPrintf(const char *fmt, ...);
 void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
 
@@ -32,5 +52,11 @@ void blackboxWriteTag2_3S32(int32_t *values);
 int blackboxWriteTag2_3SVariable(int32_t *values);
 void blackboxWriteTag8_4S16(int32_t *values);
 void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
+void blackboxWriteU8(uint8_t value);
 void blackboxWriteU32(int32_t value);
 void blackboxWriteFloat(float value);
+
+void blackboxAdaptivePredictorInit(blackboxAdaptivePredictor_t *state);
+uint8_t blackboxAdaptivePredictorSelect(blackboxAdaptivePredictor_t *state);
+int32_t blackboxAdaptivePredict(uint8_t predictor, int32_t prev1, int32_t prev2);
+void blackboxWriteArrayUsingAdaptivePredictor(blackboxAdaptivePredictor_t *state, const int16_t *curr, const int16_t *prev1, const int16_t *prev2, int count);
@@ -43,7 +43,10 @@
 #define DEBUG_BB_OUTPUT
 
 #include "blackbox.h"
+#include "blackbox_encoding.h"
 #include "blackbox_io.h"
+#include "blackbox_ring.h"
+#include "blackbox_stream.h"
 
 #include "common/maths.h"
 
@@ -59,7 +62,6 @@
 #include "drivers/sdcard.h"
 #endif
 
-#define BLACKBOX_SERIAL_PORT_MODE MODE_TX
 
 // How many bytes can we transmit per loop iteration when writing headers?
 static uint8_t blackboxMaxHeaderBytesPerIteration;
@@ -69,6 +71,12 @@ int32_t blackboxHeaderBudget;
 
 static serialPort_t *blackboxPort = NULL;
 static portSharing_e blackboxPortSharing;
+static bool blackboxSerialFraming;
+
+static blackboxStats_t blackboxStats;
+// Bytes accepted by the device since statsWindowStartMs, for blackboxStats.bytesPerSecond
+static uint32_t statsWindowBytes;
+static timeMs_t statsWindowStartMs;
 
 #ifdef USE_SDCARD
 
@@ -106,6 +114,22 @@ static uint32_t bbBits;
 static timeMs_t bbLastclearMs;
 static uint16_t bbRateMax;
 static uint32_t bbDrops;
+
+static void blackboxUpdateOutputRate(void)
+{
+    timeMs_t now = millis();
+
+    if (now > bbLastclearMs + 100) {  // Debug log every 100[msec]
+        uint16_t bbRate = ((bbBits * 10 + 5) / (now - bbLastclearMs)) / 10; // In unit of [Kbps]
+        DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 0, bbRate);
+        if (bbRate > bbRateMax) {
+            bbRateMax = bbRate;
+            DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 1, bbRateMax);
+        }
+        bbLastclearMs = now;
+        bbBits = 0;
+    }
+}
 #endif
 
 void blackboxWrite(uint8_t value)
@@ -127,6 +151,10 @@ void blackboxWrite(uint8_t value)
 #endif
     case BLACKBOX_DEVICE_SERIAL:
     default:
+        if (blackboxSerialFraming) {
+            blackboxStreamWrite(&value, 1);
+            break;
+        }
         {
             int txBytesFree = serialTxBytesFree(blackboxPort);
 
@@ -148,21 +176,108 @@ void blackboxWrite(uint8_t value)
     }
 
 #ifdef DEBUG_BB_OUTPUT
-    timeMs_t now = millis();
+    blackboxUpdateOutputRate();
+#endif
+}
 
-    if (now > bbLastclearMs + 100) {  // Debug log every 100[msec]
-        uint16_t bbRate = ((bbBits * 10 + 5) / (now - bbLastclearMs)) / 10; // In unit of [Kbps]
-        DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 0, bbRate);
-        if (bbRate > bbRateMax) {
-            bbRateMax = bbRate;
-            DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 1, bbRateMax);
+/*
+ * Write a whole frame to the device, or nothing at all if it does not fit in the device buffer right now. Returns true
+ * if the frame was written.
+ */
+static bool blackboxDeviceWriteBuf(const uint8_t *data, int length)
+{
+#ifdef DEBUG_BB_OUTPUT
+    bbBits += 8 * length;
+#endif
+
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        if ((int)flashfsGetWriteBufferFreeSpace() < length) {
+            return false;
         }
-        bbLastclearMs = now;
-        bbBits = 0;
+        flashfsWrite(data, length, false); // Write asynchronously
+        break;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        if ((int)afatfs_getFreeBufferSpace() < length) {
+            return false;
+        }
+        if (afatfs_fwrite(blackboxSDCard.logFile, data, length) < (uint32_t)length) {
+            // Part of the frame may have made it into the file, but it's lost either way
+            return false;
+        }
+        break;
+#endif
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+        {
+            const int txBytesFree = blackboxSerialFraming ? blackboxStreamBytesFree() : (int)serialTxBytesFree(blackboxPort);
+
+#ifdef DEBUG_BB_OUTPUT
+            bbBits += 2 * length;
+            DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 3, txBytesFree);
+#endif
+
+            // Drop the whole frame rather than its tail so that the decoder can resynchronise on the next one
+            if (txBytesFree < length) {
+#ifdef DEBUG_BB_OUTPUT
+                ++bbDrops;
+                DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 2, bbDrops);
+#endif
+                return false;
+            }
+            if (blackboxSerialFraming) {
+                blackboxStreamWrite(data, length);
+            } else {
+                serialWriteBuf(blackboxPort, data, length);
+            }
+        }
+        break;
+    }
+
+    statsWindowBytes += length;
+
+#ifdef DEBUG_BB_OUTPUT
+    blackboxUpdateOutputRate();
+#endif
+
+    return true;
+}
+
+// Write a complete frame, to the ring while it is capturing or else to the device. Returns true if the frame was kept.
+bool blackboxWriteBuf(const uint8_t *data, int length)
+{
+#ifdef USE_BLACKBOX_RING
+    if (blackboxRingIsCapturing()) {
+        return blackboxRingAppend(data, length);
     }
 #endif
+
+    return blackboxDeviceWriteBuf(data, length);
 }
 
+#ifdef USE_BLACKBOX_RING
+/*
+ * Move frames from the ring to the device until the device buffer is full. Returns true once the ring is empty.
+ */
+bool blackboxDeviceWriteRing(void)
+{
+    static uint8_t frame[BLACKBOX_FRAME_BUFFER_SIZE];
+    int length;
+
+    while ((length = blackboxRingPeek(frame, sizeof(frame))) > 0) {
+        if (!blackboxDeviceWriteBuf(frame, length)) {
+            return false;
+        }
+        blackboxRingPop();
+    }
+
+    return true;
+}
+#endif
+
 // Print the null-terminated string 's' to the blackbox device and return the number of bytes written
 int blackboxWriteString(const char *s)
 {
@@ -200,6 +315,59 @@ int blackboxWriteString(const char *s)
     return length;
 }
 
+/*
+ * Percentage of the device buffer holding data that has yet to be handed to the device, or -1 if unknown.
+ */
+static int blackboxDeviceBufferUsedPercent(void)
+{
+    int size;
+    int freeSpace;
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        // USB VCP has no tx buffer
+        size = blackboxPort->txBufferSize;
+        freeSpace = serialTxBytesFree(blackboxPort);
+        break;
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        size = flashfsGetWriteBufferSize();
+        freeSpace = flashfsGetWriteBufferFreeSpace();
+        break;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        size = afatfs_getBufferSize();
+        freeSpace = afatfs_getFreeBufferSpace();
+        break;
+#endif
+    default:
+        return -1;
+    }
+
+    if (size <= 0) {
+        return -1;
+    }
+
+    return constrain(100 - freeSpace * 100 / size, 0, 100);
+}
+
+static void blackboxUpdateStats(void)
+{
+    const int bufferUsed = blackboxDeviceBufferUsedPercent();
+    if (bufferUsed > blackboxStats.bufferUsedMaxPercent) {
+        blackboxStats.bufferUsedMaxPercent = bufferUsed;
+    }
+
+    const timeMs_t nowMs = millis();
+    const timeMs_t windowMs = nowMs - statsWindowStartMs;
+    if (windowMs >= 1000) {
+        blackboxStats.bytesPerSecond = statsWindowBytes * 1000 / windowMs;
+        statsWindowBytes = 0;
+        statsWindowStartMs = nowMs;
+    }
+}
+
 /**
  * If there is data waiting to be written to the blackbox device, attempt to write (a portion of) that now.
  *
@@ -207,6 +375,10 @@ int blackboxWriteString(const char *s)
  */
 void blackboxDeviceFlush(void)
 {
+    blackboxUpdateStats();
+
+    const timeUs_t startUs = micros();
+
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
         /*
@@ -218,9 +390,22 @@ void blackboxDeviceFlush(void)
         break;
 #endif // USE_FLASHFS
 
+    case BLACKBOX_DEVICE_SERIAL:
+        if (blackboxSerialFraming) {
+            blackboxStreamFlush();
+        }
+        break;
+
     default:
         ;
     }
+
+    const timeDelta_t flushUs = cmpTimeUs(micros(), startUs);
+    int bucket = 0;
+    while (bucket < BLACKBOX_STATS_FLUSH_BUCKET_COUNT - 1 && flushUs >= (BLACKBOX_STATS_FLUSH_BUCKET_MIN_US << bucket)) {
+        bucket++;
+    }
+    blackboxStats.flushLatency[bucket]++;
 }
 
 /**
@@ -232,6 +417,9 @@ bool blackboxDeviceFlushForce(void)
 {
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
+        if (blackboxSerialFraming) {
+            return blackboxStreamFlushForce();
+        }
         // Nothing to speed up flushing on serial, as serial is continuously being drained out of its buffer
         return isSerialTransmitBufferEmpty(blackboxPort);
 
@@ -304,8 +492,14 @@ bool blackboxDeviceOpen(void)
                 portOptions |= SERIAL_STOPBITS_1;
             }
 
+            blackboxSerialFraming = blackboxConfig()->serial_framing;
+            const bool flowControl = blackboxSerialFraming && blackboxConfig()->serial_flow_control;
+
             blackboxPort = openSerialPort(portConfig->identifier, FUNCTION_BLACKBOX, NULL, NULL, baudRates[baudRateIndex],
-                BLACKBOX_SERIAL_PORT_MODE, portOptions);
+                flowControl ? MODE_RXTX : MODE_TX, portOptions);
+            if (blackboxPort && blackboxSerialFraming) {
+                blackboxStreamInit(blackboxPort, flowControl);
+            }
 
             /*
              * The slowest MicroSD cards have a write latency approaching 400ms. The OpenLog's buffer is about 900
@@ -345,6 +539,8 @@ bool blackboxDeviceOpen(void)
             return false;
         }
 
+        flashfsOpen();
+
         blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
 
         return true;
@@ -669,7 +865,7 @@ void blackboxReplenishHeaderBudget(void)
 
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
-        freeSpace = serialTxBytesFree(blackboxPort);
+        freeSpace = blackboxSerialFraming ? blackboxStreamBytesFree() : (int)serialTxBytesFree(blackboxPort);
         break;
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
@@ -751,6 +947,55 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
     }
 }
 
+void blackboxStatsRecordFrame(uint8_t frameType, bool logged)
+{
+    blackboxStatsFrame_e frame;
+
+    switch (frameType) {
+    case 'I':
+        frame = BLACKBOX_STATS_FRAME_I;
+        break;
+    case 'P':
+        frame = BLACKBOX_STATS_FRAME_P;
+        break;
+    case 'S':
+        frame = BLACKBOX_STATS_FRAME_S;
+        break;
+    default:
+        frame = BLACKBOX_STATS_FRAME_OTHER;
+        break;
+    }
+
+    if (logged) {
+        blackboxStats.framesLogged[frame]++;
+    } else {
+        blackboxStats.framesDropped[frame]++;
+    }
+}
+
+const blackboxStats_t *blackboxGetStats(void)
+{
+    return &blackboxStats;
+}
+
+uint32_t blackboxGetDroppedFrameCount(void)
+{
+    uint32_t dropped = 0;
+
+    for (int i = 0; i < BLACKBOX_STATS_FRAME_COUNT; i++) {
+        dropped += blackboxStats.framesDropped[i];
+    }
+
+    return dropped;
+}
+
+void blackboxResetStats(void)
+{
+    memset(&blackboxStats, 0, sizeof(blackboxStats));
+    statsWindowBytes = 0;
+    statsWindowStartMs = millis();
+}
+
 int8_t blackboxGetLogFileNo(void)
 {   
 #ifdef USE_BLACKBOX
@@ -40,9 +40,33 @@ typedef enum {
 
 extern int32_t blackboxHeaderBudget;
 
+typedef enum {
+    BLACKBOX_STATS_FRAME_I,
+    BLACKBOX_STATS_FRAME_P,
+    BLACKBOX_STATS_FRAME_S,
+    BLACKBOX_STATS_FRAME_OTHER, // GPS and event frames
+    BLACKBOX_STATS_FRAME_COUNT
+} blackboxStatsFrame_e;
+
+// Bucket n counts device flushes that took less than 16us << n, the last bucket counts the rest
+#define BLACKBOX_STATS_FLUSH_BUCKET_COUNT 8
+#define BLACKBOX_STATS_FLUSH_BUCKET_MIN_US 16
+
+typedef struct blackboxStats_s {
+    uint32_t framesLogged[BLACKBOX_STATS_FRAME_COUNT];
+    uint32_t framesDropped[BLACKBOX_STATS_FRAME_COUNT];  // Frames skipped because the device buffer was full
+    uint32_t bytesPerSecond;                             // Frame data accepted by the device over the last second
+    uint32_t flushLatency[BLACKBOX_STATS_FLUSH_BUCKET_COUNT]; // Histogram of blackboxDeviceFlush() durations
+    uint8_t bufferUsedMaxPercent;                        // Peak occupancy of the device buffer
+} blackboxStats_t;
+
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
+bool blackboxWriteBuf(const uint8_t *data, int length);
 int blackboxWriteString(const char *s);
+#ifdef USE_BLACKBOX_RING
+bool blackboxDeviceWriteRing(void);
+#endif
 
 void blackboxDeviceFlush(void);
 bool blackboxDeviceFlushForce(void);
@@ -64,3 +88,8 @@ int32_t blackboxGetLogNumber(void);
 void blackboxReplenishHeaderBudget(void);
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
 int8_t blackboxGetLogFileNo(void);
+
+void blackboxStatsRecordFrame(uint8_t frameType, bool logged);
+const blackboxStats_t *blackboxGetStats(void);
+uint32_t blackboxGetDroppedFrameCount(void);
+void blackboxResetStats(void);
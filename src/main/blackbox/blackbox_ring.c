@@ -0,0 +1,239 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * RAM ring of encoded frames for BLACKBOX_MODE_TRIGGERED. Frames are stored as records, a 16 bit length followed by
+ * the frame bytes, and the oldest records are discarded to make room for new ones.
+ *
+ * A decoder can only pick up the stream at an I frame that is preceded by a logging resume event, so the record that
+ * holds such an event is marked as a sync point and also stores its time. Reading starts at a sync point, and the
+ * sync points that follow are skipped unless records were discarded in between.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_RING
+
+#include "blackbox_ring.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#define RING_RECORD_SYNC 0x8000
+#define RING_RECORD_LENGTH_MASK 0x7fff
+#define RING_RECORD_HEADER_SIZE 2
+#define RING_RECORD_TIME_SIZE 4
+
+static uint8_t ringBuffer[BLACKBOX_RING_BUFFER_SIZE];
+static uint32_t ringHead; // Where the next record is written
+static uint32_t ringTail; // Oldest record
+static uint32_t ringUsed;
+
+static bool ringCapture;
+// The next record appended is a sync point
+static bool ringPendingSync;
+static timeMs_t ringPendingSyncTimeMs;
+// Reading must restart from a sync point, as records were discarded since the last one read
+static bool ringResync;
+
+static void ringWrite(uint32_t offset, const uint8_t *data, uint32_t length)
+{
+    const uint32_t first = MIN(length, BLACKBOX_RING_BUFFER_SIZE - offset);
+
+    memcpy(&ringBuffer[offset], data, first);
+    memcpy(ringBuffer, data + first, length - first);
+}
+
+static void ringRead(uint32_t offset, uint8_t *data, uint32_t length)
+{
+    const uint32_t first = MIN(length, BLACKBOX_RING_BUFFER_SIZE - offset);
+
+    memcpy(data, &ringBuffer[offset], first);
+    memcpy(data + first, ringBuffer, length - first);
+}
+
+static uint32_t ringOffset(uint32_t offset, uint32_t length)
+{
+    return (offset + length) % BLACKBOX_RING_BUFFER_SIZE;
+}
+
+static uint16_t ringTailHeader(void)
+{
+    uint8_t header[RING_RECORD_HEADER_SIZE];
+
+    ringRead(ringTail, header, sizeof(header));
+
+    return header[0] | (header[1] << 8);
+}
+
+static timeMs_t ringTailTime(void)
+{
+    uint8_t time[RING_RECORD_TIME_SIZE];
+
+    ringRead(ringOffset(ringTail, RING_RECORD_HEADER_SIZE), time, sizeof(time));
+
+    return time[0] | (time[1] << 8) | (time[2] << 16) | ((uint32_t)time[3] << 24);
+}
+
+static uint32_t ringRecordSize(uint16_t header)
+{
+    return RING_RECORD_HEADER_SIZE + ((header & RING_RECORD_SYNC) ? RING_RECORD_TIME_SIZE : 0) + (header & RING_RECORD_LENGTH_MASK);
+}
+
+static void ringDropTail(void)
+{
+    const uint32_t size = ringRecordSize(ringTailHeader());
+
+    ringTail = ringOffset(ringTail, size);
+    ringUsed -= size;
+}
+
+void blackboxRingReset(void)
+{
+    ringHead = 0;
+    ringTail = 0;
+    ringUsed = 0;
+    ringPendingSync = false;
+    ringResync = true;
+}
+
+/*
+ * While capturing, blackboxWriteBuf() appends frames to the ring rather than writing them to the device.
+ */
+void blackboxRingSetCapture(bool capture)
+{
+    ringCapture = capture;
+}
+
+bool blackboxRingIsCapturing(void)
+{
+    return ringCapture;
+}
+
+/*
+ * Mark the next record appended, which must be a logging resume event, as a point where decoding can start.
+ */
+void blackboxRingMarkSyncPoint(timeMs_t timeMs)
+{
+    ringPendingSync = true;
+    ringPendingSyncTimeMs = timeMs;
+}
+
+/*
+ * Append a frame, discarding the oldest records to make room for it. Returns false if the frame is larger than the ring.
+ */
+bool blackboxRingAppend(const uint8_t *data, int length)
+{
+    const bool sync = ringPendingSync;
+    const uint16_t header = length | (sync ? RING_RECORD_SYNC : 0);
+    const uint32_t size = ringRecordSize(header);
+
+    ringPendingSync = false;
+
+    if (length > RING_RECORD_LENGTH_MASK || size > BLACKBOX_RING_BUFFER_SIZE) {
+        return false;
+    }
+
+    while (BLACKBOX_RING_BUFFER_SIZE - ringUsed < size) {
+        ringDropTail();
+        ringResync = true;
+    }
+
+    const uint8_t headerBytes[RING_RECORD_HEADER_SIZE] = { header & 0xff, header >> 8 };
+    ringWrite(ringHead, headerBytes, sizeof(headerBytes));
+    uint32_t offset = ringOffset(ringHead, RING_RECORD_HEADER_SIZE);
+
+    if (sync) {
+        const uint8_t time[RING_RECORD_TIME_SIZE] = {
+            ringPendingSyncTimeMs & 0xff, (ringPendingSyncTimeMs >> 8) & 0xff,
+            (ringPendingSyncTimeMs >> 16) & 0xff, ringPendingSyncTimeMs >> 24
+        };
+        ringWrite(offset, time, sizeof(time));
+        offset = ringOffset(offset, RING_RECORD_TIME_SIZE);
+    }
+
+    ringWrite(offset, data, length);
+    ringHead = ringOffset(offset, length);
+    ringUsed += size;
+
+    return true;
+}
+
+/*
+ * Discard the history from before oldestMs, so that reading starts at the first sync point at or after it.
+ */
+void blackboxRingTrim(timeMs_t oldestMs)
+{
+    while (ringUsed) {
+        if ((ringTailHeader() & RING_RECORD_SYNC) && cmp32(ringTailTime(), oldestMs) >= 0) {
+            break;
+        }
+        ringDropTail();
+    }
+    ringResync = true;
+}
+
+/*
+ * Copy the oldest record that belongs in the log to data and return its length, or 0 if there is none. Records that
+ * cannot be decoded, and sync points that are not needed, are discarded on the way.
+ */
+int blackboxRingPeek(uint8_t *data, int maxLength)
+{
+    while (ringUsed) {
+        const uint16_t header = ringTailHeader();
+        const bool sync = header & RING_RECORD_SYNC;
+        const int length = header & RING_RECORD_LENGTH_MASK;
+
+        if (sync != ringResync || length > maxLength) {
+            ringDropTail();
+            continue;
+        }
+
+        ringRead(ringOffset(ringTail, ringRecordSize(header) - length), data, length);
+
+        return length;
+    }
+
+    return 0;
+}
+
+/*
+ * Discard the record returned by blackboxRingPeek() once it has been written.
+ */
+void blackboxRingPop(void)
+{
+    if (ringUsed) {
+        if (ringTailHeader() & RING_RECORD_SYNC) {
+            ringResync = false;
+        }
+        ringDropTail();
+    }
+}
+
+uint32_t blackboxRingGetUsed(void)
+{
+    return ringUsed;
+}
+
+#endif // USE_BLACKBOX_RING
@@ -0,0 +1,43 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/time.h"
+
+// RAM holding the frames encoded ahead of a trigger in BLACKBOX_MODE_TRIGGERED, which bounds the pre-trigger history
+#ifndef BLACKBOX_RING_BUFFER_SIZE
+#define BLACKBOX_RING_BUFFER_SIZE (32 * 1024)
+#endif
+
+void blackboxRingReset(void);
+void blackboxRingSetCapture(bool capture);
+bool blackboxRingIsCapturing(void);
+
+void blackboxRingMarkSyncPoint(timeMs_t timeMs);
+bool blackboxRingAppend(const uint8_t *data, int length);
+void blackboxRingTrim(timeMs_t oldestMs);
+
+int blackboxRingPeek(uint8_t *data, int maxLength);
+void blackboxRingPop(void);
+uint32_t blackboxRingGetUsed(void);
@@ -0,0 +1,158 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX
+
+#include "blackbox_stream.h"
+
+#include "common/crc.h"
+#include "common/maths.h"
+
+static serialPort_t *streamPort;
+static bool streamFlowControl;
+static bool streamPaused;
+static uint16_t streamSequence;
+
+// Packet being assembled, its payload is sent once it is full or the port runs out of data to send
+static uint8_t streamPacket[BLACKBOX_STREAM_PACKET_SIZE];
+static int streamPayloadLength;
+
+void blackboxStreamInit(serialPort_t *port, bool flowControl)
+{
+    streamPort = port;
+    streamFlowControl = flowControl;
+    streamPaused = false;
+    streamSequence = 0;
+    streamPayloadLength = 0;
+}
+
+static void blackboxStreamSendPacket(void)
+{
+    streamPacket[0] = BLACKBOX_STREAM_SYNC_1;
+    streamPacket[1] = BLACKBOX_STREAM_SYNC_2;
+    streamPacket[2] = streamSequence & 0xff;
+    streamPacket[3] = streamSequence >> 8;
+    streamPacket[4] = streamPayloadLength;
+
+    const uint16_t crc = crc16_ccitt_update(0, &streamPacket[2], BLACKBOX_STREAM_HEADER_SIZE - 2 + streamPayloadLength);
+    uint8_t *crcPos = &streamPacket[BLACKBOX_STREAM_HEADER_SIZE + streamPayloadLength];
+    crcPos[0] = crc & 0xff;
+    crcPos[1] = crc >> 8;
+
+    serialWriteBuf(streamPort, streamPacket, BLACKBOX_STREAM_HEADER_SIZE + streamPayloadLength + BLACKBOX_STREAM_CRC_SIZE);
+
+    streamSequence++;
+    streamPayloadLength = 0;
+}
+
+static void blackboxStreamPollFlowControl(void)
+{
+    if (!streamFlowControl) {
+        return;
+    }
+
+    while (serialRxBytesWaiting(streamPort)) {
+        const uint8_t c = serialRead(streamPort);
+        if (c == BLACKBOX_STREAM_XOFF) {
+            streamPaused = true;
+        } else if (c == BLACKBOX_STREAM_XON) {
+            streamPaused = false;
+        }
+    }
+}
+
+/*
+ * Number of log bytes that can be written without overflowing the port's tx buffer, 0 while the recorder holds the
+ * stream.
+ */
+int blackboxStreamBytesFree(void)
+{
+    blackboxStreamPollFlowControl();
+
+    if (streamPaused) {
+        return 0;
+    }
+
+    // Filling the current packet sends nothing, each packet completed after that needs room for a whole packet
+    const int packets = serialTxBytesFree(streamPort) / BLACKBOX_STREAM_PACKET_SIZE;
+
+    return BLACKBOX_STREAM_PAYLOAD_SIZE - streamPayloadLength + packets * BLACKBOX_STREAM_PAYLOAD_SIZE;
+}
+
+/*
+ * Add the whole of data to the stream, or nothing if it does not fit right now. Returns true if it was added.
+ */
+bool blackboxStreamWrite(const uint8_t *data, int length)
+{
+    if (length > blackboxStreamBytesFree()) {
+        return false;
+    }
+
+    while (length > 0) {
+        // A full packet is only sent once there is more data, so that a flush has nothing left to send
+        if (streamPayloadLength == BLACKBOX_STREAM_PAYLOAD_SIZE) {
+            blackboxStreamSendPacket();
+        }
+
+        const int chunk = MIN(length, BLACKBOX_STREAM_PAYLOAD_SIZE - streamPayloadLength);
+        memcpy(&streamPacket[BLACKBOX_STREAM_HEADER_SIZE + streamPayloadLength], data, chunk);
+        streamPayloadLength += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+
+    return true;
+}
+
+/*
+ * Send the packet being assembled once the port has nothing else to send. The link is saturated otherwise, and then
+ * packets are only sent when they are full so that little bandwidth is spent on packet overhead.
+ */
+void blackboxStreamFlush(void)
+{
+    blackboxStreamPollFlowControl();
+
+    if (streamPayloadLength && !streamPaused && isSerialTransmitBufferEmpty(streamPort)) {
+        blackboxStreamSendPacket();
+    }
+}
+
+/*
+ * Send the packet being assembled as soon as there is room for it. Returns true once all of the stream has been sent.
+ */
+bool blackboxStreamFlushForce(void)
+{
+    blackboxStreamPollFlowControl();
+
+    if (streamPayloadLength && !streamPaused
+        && serialTxBytesFree(streamPort) >= (uint32_t)(BLACKBOX_STREAM_HEADER_SIZE + streamPayloadLength + BLACKBOX_STREAM_CRC_SIZE)) {
+        blackboxStreamSendPacket();
+    }
+
+    return streamPayloadLength == 0 && isSerialTransmitBufferEmpty(streamPort);
+}
+
+#endif // USE_BLACKBOX
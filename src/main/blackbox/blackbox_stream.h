@@ -0,0 +1,51 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "drivers/serial.h"
+
+/*
+ * Framed serial log stream. The log is carried in packets of:
+ *
+ *     0xAA 0x55 <sequence u16> <length u8> <payload> <crc u16>
+ *
+ * Multi-byte fields are little endian. The sequence number starts at 0 for every log and the CRC is CRC16-CCITT of the
+ * sequence, length and payload. With flow control the recorder sends XOFF to hold the stream and XON to resume it.
+ */
+#define BLACKBOX_STREAM_SYNC_1          0xAA
+#define BLACKBOX_STREAM_SYNC_2          0x55
+#define BLACKBOX_STREAM_HEADER_SIZE     5
+#define BLACKBOX_STREAM_CRC_SIZE        2
+// Two full packets fit in the smallest UART tx buffer
+#define BLACKBOX_STREAM_PAYLOAD_SIZE    120
+#define BLACKBOX_STREAM_PACKET_SIZE     (BLACKBOX_STREAM_HEADER_SIZE + BLACKBOX_STREAM_PAYLOAD_SIZE + BLACKBOX_STREAM_CRC_SIZE)
+
+#define BLACKBOX_STREAM_XON             0x11
+#define BLACKBOX_STREAM_XOFF            0x13
+
+void blackboxStreamInit(serialPort_t *port, bool flowControl);
+int blackboxStreamBytesFree(void);
+bool blackboxStreamWrite(const uint8_t *data, int length);
+void blackboxStreamFlush(void);
+bool blackboxStreamFlushForce(void);
@@ -101,5 +101,9 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "RX_EXPRESSLRS_PHASELOCK",
     "RX_STATE_TIME",
     "SMITH_PREDICTOR",
+    "GYRO_FUSION",
+    "GYRO_FIFO",
+    "FLASHFS",
+    "MOTOR_LATENCY",
     // "BMI270_GYRO",
 };
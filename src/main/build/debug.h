@@ -99,6 +99,10 @@ typedef enum {
     DEBUG_RX_EXPRESSLRS_PHASELOCK,
     DEBUG_RX_STATE_TIME,
     DEBUG_SMITH_PREDICTOR,
+    DEBUG_GYRO_FUSION,
+    DEBUG_GYRO_FIFO,
+    DEBUG_FLASHFS,
+    DEBUG_MOTOR_LATENCY,
     // DEBUG_BMI270_GYRO,
     DEBUG_COUNT
 } debugType_e;
@@ -35,6 +35,7 @@ bool cliMode = false;
 #ifdef USE_CLI
 
 #include "blackbox/blackbox.h"
+#include "blackbox/blackbox_io.h"
 
 #include "build/build_config.h"
 #include "build/debug.h"
@@ -79,6 +80,7 @@ bool cliMode = false;
 #include "drivers/io.h"
 #include "drivers/io_impl.h"
 #include "drivers/light_led.h"
+#include "drivers/motor_latency.h"
 #include "drivers/motor.h"
 #include "drivers/rangefinder/rangefinder_hcsr04.h"
 #include "drivers/resource.h"
@@ -158,6 +160,7 @@ bool cliMode = false;
 #include "rx/rx_spi.h"
 
 #include "scheduler/scheduler.h"
+#include "scheduler/scheduler_trace.h"
 
 #include "sensors/acceleration.h"
 #include "sensors/adcinternal.h"
@@ -2489,6 +2492,18 @@ static void cliFlashInfo(const char *cmdName, char *cmdline)
             FLASH_PARTITION_SECTOR_COUNT(flashPartition) * layout->sectorSize,
             flashfsGetOffset()
     );
+
+    const flashfsStats_t *stats = flashfsGetStats();
+    cliPrintLinef("FlashFS buffer=%u, maxUsed=%u, dropped=%u, stalls=%u, stallTime=%uus, maxStall=%uus",
+            FLASHFS_WRITE_BUFFER_SIZE, stats->bufferUsedMax, stats->bytesDropped,
+            stats->stallCount, stats->stallTimeUs, stats->stallTimeMaxUs
+    );
+#ifdef USE_FLASHFS_INDEX
+    const int indexRecords = flashfsIndexGetRecordCount();
+    if (indexRecords >= 0) {
+        cliPrintLinef("FlashFS index records=%d", indexRecords);
+    }
+#endif
 #endif
 }
 
@@ -3633,11 +3648,11 @@ static void cliDumpGyroRegisters(const char *cmdName, char *cmdline)
     UNUSED(cmdline);
 
 #ifdef USE_MULTI_GYRO
-    if ((gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_1) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_BOTH)) {
+    if ((gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_1) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_BOTH) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_FUSED)) {
         cliPrintLinef("\r\n# Gyro 1");
         cliPrintGyroRegisters(GYRO_CONFIG_USE_GYRO_1);
     }
-    if ((gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_2) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_BOTH)) {
+    if ((gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_2) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_BOTH) || (gyroConfig()->gyro_to_use == GYRO_CONFIG_USE_GYRO_FUSED)) {
         cliPrintLinef("\r\n# Gyro 2");
         cliPrintGyroRegisters(GYRO_CONFIG_USE_GYRO_2);
     }
@@ -4897,6 +4912,20 @@ static void cliStatus(const char *cmdName, char *cmdline)
     cliSdInfo(cmdName, "");
 #endif
 
+#ifdef USE_BLACKBOX
+    const blackboxStats_t *blackboxStats = blackboxGetStats();
+    cliPrintLinef("Blackbox dropped/logged frames: I %u/%u, P %u/%u, S %u/%u, rate: %u bytes/s, buffer peak: %u%%",
+            blackboxStats->framesDropped[BLACKBOX_STATS_FRAME_I], blackboxStats->framesLogged[BLACKBOX_STATS_FRAME_I],
+            blackboxStats->framesDropped[BLACKBOX_STATS_FRAME_P], blackboxStats->framesLogged[BLACKBOX_STATS_FRAME_P],
+            blackboxStats->framesDropped[BLACKBOX_STATS_FRAME_S], blackboxStats->framesLogged[BLACKBOX_STATS_FRAME_S],
+            blackboxStats->bytesPerSecond, blackboxStats->bufferUsedMaxPercent);
+    cliPrint("Blackbox flush time:");
+    for (int i = 0; i < BLACKBOX_STATS_FLUSH_BUCKET_COUNT - 1; i++) {
+        cliPrintf(" <%dus %u,", BLACKBOX_STATS_FLUSH_BUCKET_MIN_US << i, blackboxStats->flushLatency[i]);
+    }
+    cliPrintLinef(" more %u", blackboxStats->flushLatency[BLACKBOX_STATS_FLUSH_BUCKET_COUNT - 1]);
+#endif
+
     cliPrint("Arming disable flags:");
     armingDisableFlags_e flags = getArmingDisableFlags();
     while (flags) {
@@ -4969,6 +4998,78 @@ static void cliTasks(const char *cmdName, char *cmdline)
     }
 }
 
+#ifdef USE_SCHEDULER_TRACE
+static void cliTaskTrace(const char *cmdName, char *cmdline)
+{
+    static const char * const traceStateNames[] = { "STOPPED", "RUNNING", "ARMED" };
+
+    if (isEmpty(cmdline)) {
+        cliPrintLinef("Task trace %s, %d entries", traceStateNames[schedulerTraceGetState()], schedulerTraceCount());
+    } else if (strncasecmp(cmdline, "start", 5) == 0) {
+        schedulerTraceStart(SCHEDULER_TRACE_RUNNING);
+    } else if (strncasecmp(cmdline, "late", 4) == 0) {
+        schedulerTraceStart(SCHEDULER_TRACE_ARMED_LATE);
+    } else if (strncasecmp(cmdline, "stop", 4) == 0) {
+        schedulerTraceStop();
+    } else if (strncasecmp(cmdline, "dump", 4) == 0) {
+        // Chrome trace JSON, paste into a file and open with chrome://tracing or ui.perfetto.dev
+        schedulerTraceStop();
+
+        schedulerTraceEntry_t entry;
+        const uint32_t baseCycles = schedulerTraceGet(0, &entry) ? entry.startCycles : 0;
+        const unsigned count = schedulerTraceCount();
+        char buf[SCHEDULER_TRACE_EVENT_LENGTH];
+
+        cliPrintLine("{\"traceEvents\":[");
+        for (unsigned i = 0; schedulerTraceGet(i, &entry); i++) {
+            schedulerTraceFormatEvent(buf, &entry, baseCycles);
+            cliPrintLinef("%s%s", buf, (i + 1 < count) ? "," : "");
+        }
+        cliPrintLine("]}");
+#ifdef SIMULATOR_BUILD
+    } else if (strncasecmp(cmdline, "save", 4) == 0) {
+        const char *filename = nextArg(cmdline);
+        if (!filename) {
+            filename = "scheduler_trace.json";
+        }
+        if (schedulerTraceWriteFile(filename)) {
+            cliPrintLinef("Saved %s", filename);
+        } else {
+            cliPrintErrorLinef(cmdName, "CANNOT WRITE %s", filename);
+        }
+#endif
+    } else {
+        cliShowParseError(cmdName);
+    }
+}
+#endif
+
+#ifdef USE_MOTOR_LATENCY_STATS
+static void cliMotorLatency(const char *cmdName, char *cmdline)
+{
+    if (strncasecmp(cmdline, "reset", 5) == 0) {
+        motorLatencyReset();
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError(cmdName);
+        return;
+    }
+
+    if (!motorLatencyIsEnabled()) {
+        cliPrintLine("Not recording, set debug_mode = MOTOR_LATENCY");
+    }
+
+    const motorLatencyStats_t *stats = motorLatencyGetStats();
+    const uint32_t averageUs10 = motorLatencyAverageUs10();
+    cliPrintLinef("Gyro to motor output: %u samples, min %u.%uus, max %u.%uus, avg %u.%uus, skipped updates %u",
+        stats->sampleCount, stats->minUs10 / 10, stats->minUs10 % 10, stats->maxUs10 / 10, stats->maxUs10 % 10,
+        averageUs10 / 10, averageUs10 % 10, stats->skippedUpdates);
+    for (int i = 0; i < MOTOR_LATENCY_BUCKET_COUNT - 1; i++) {
+        cliPrintLinef("%3d-%3dus %u", i * MOTOR_LATENCY_BUCKET_WIDTH_US, (i + 1) * MOTOR_LATENCY_BUCKET_WIDTH_US, stats->histogram[i]);
+    }
+    cliPrintLinef("   >%3dus %u", (MOTOR_LATENCY_BUCKET_COUNT - 1) * MOTOR_LATENCY_BUCKET_WIDTH_US, stats->histogram[MOTOR_LATENCY_BUCKET_COUNT - 1]);
+}
+#endif
+
 static void printVersion(const char *cmdName, bool printBoardInfo)
 {
 #if !(defined(USE_CUSTOM_DEFAULTS) && defined(USE_UNIFIED_TARGET))
@@ -6583,6 +6684,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("mode_color", "configure mode and special colors", NULL, cliModeColor),
 #endif
     CLI_COMMAND_DEF("motor",  "get/set motor", "<index> [<value>]", cliMotor),
+#ifdef USE_MOTOR_LATENCY_STATS
+    CLI_COMMAND_DEF("motor_latency", "show gyro to motor output latency", "[reset]", cliMotorLatency),
+#endif
 #ifdef USE_USB_MSC
 #ifdef USE_RTC_TIME
     CLI_COMMAND_DEF("msc", "switch into msc mode", "[<timezone offset minutes>]", cliMsc),
@@ -6633,6 +6737,13 @@ const clicmd_t cmdTable[] = {
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
     CLI_COMMAND_DEF("tasks", "show task stats", NULL, cliTasks),
+#ifdef USE_SCHEDULER_TRACE
+#ifdef SIMULATOR_BUILD
+    CLI_COMMAND_DEF("tasktrace", "record scheduler task trace", "[start|late|stop|dump|save [<file>]]", cliTaskTrace),
+#else
+    CLI_COMMAND_DEF("tasktrace", "record scheduler task trace", "[start|late|stop|dump]", cliTaskTrace),
+#endif
+#endif
 #ifdef USE_TIMER_MGMT
     CLI_COMMAND_DEF("timer", "show/set timers", "<> | <pin> list | <pin> [af<alternate function>|none|<option(deprecated)>] | list | show", cliTimer),
 #endif
@@ -42,6 +42,7 @@ typedef enum {
     TABLE_BLACKBOX_DEVICE,
     TABLE_BLACKBOX_MODE,
     TABLE_BLACKBOX_SAMPLE_RATE,
+    TABLE_BLACKBOX_COMPRESSION,
 #endif
     TABLE_CURRENT_METER,
     TABLE_VOLTAGE_METER,
@@ -87,6 +88,7 @@ typedef enum {
     TABLE_GYRO_OVERFLOW_CHECK,
 #endif
     TABLE_RATES_TYPE,
+    TABLE_IMU_ESTIMATOR,
 #ifdef USE_OVERCLOCK
     TABLE_OVERCLOCK,
 #endif
@@ -144,6 +146,13 @@ typedef enum {
 #ifdef USE_RX_EXPRESSLRS
     TABLE_FREQ_DOMAIN,
     TABLE_SWITCH_MODE,
+#endif
+#ifdef USE_DYN_NOTCH_FILTER
+    TABLE_DYN_NOTCH_ENGINE,
+    TABLE_DYN_NOTCH_SDFT_SIZE,
+#endif
+#ifdef USE_SCHEDULER_EDF
+    TABLE_SCHEDULER_MODE,
 #endif
     LOOKUP_TABLE_COUNT
 } lookupTableIndex_e;
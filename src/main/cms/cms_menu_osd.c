@@ -152,6 +152,7 @@ const OSD_Entry menuOsdActiveElemsEntries[] =
     {"MOTOR DIAGNOSTIC",   OME_VISIBLE | DYNAMIC, NULL, &osdConfig_item_pos[OSD_MOTOR_DIAG]},
 #ifdef USE_BLACKBOX
     {"LOG STATUS",         OME_VISIBLE | DYNAMIC, NULL, &osdConfig_item_pos[OSD_LOG_STATUS]},
+    {"BLACKBOX STATS",     OME_VISIBLE | DYNAMIC, NULL, &osdConfig_item_pos[OSD_BLACKBOX_STATS]},
 #endif
     {"FLIP ARROW",         OME_VISIBLE | DYNAMIC, NULL, &osdConfig_item_pos[OSD_FLIP_ARROW]},
 #ifdef USE_RX_LINK_QUALITY_INFO
@@ -130,6 +130,122 @@ FAST_CODE float pt3FilterApply(pt3Filter_t *filter, float input)
 }
 
 
+// Fixed point filters, see filter.h for the formats
+
+FAST_CODE int32_t nullFilterFixedApply(filter_t *filter, int32_t input)
+{
+    UNUSED(filter);
+    return input;
+}
+
+static int32_t filterFixedGain(float k)
+{
+    // Q31 cannot hold 1.0
+    return (k >= 1.0f) ? INT32_MAX : lrintf(MAX(k, 0.0f) * (float)(1u << FILTER_FIXED_GAIN_SHIFT));
+}
+
+static FAST_CODE int32_t filterFixedGainApply(int32_t k, int32_t state, int32_t input)
+{
+    return state + (int32_t)(((int64_t)k * (input - state)) >> FILTER_FIXED_GAIN_SHIFT);
+}
+
+void pt1FilterFixedInit(pt1FilterFixed_t *filter, float k)
+{
+    filter->state = 0;
+    filter->k = filterFixedGain(k);
+}
+
+void pt1FilterFixedUpdateCutoff(pt1FilterFixed_t *filter, float k)
+{
+    filter->k = filterFixedGain(k);
+}
+
+FAST_CODE int32_t pt1FilterFixedApply(pt1FilterFixed_t *filter, int32_t input)
+{
+    filter->state = filterFixedGainApply(filter->k, filter->state, input);
+    return filter->state;
+}
+
+void pt2FilterFixedInit(pt2FilterFixed_t *filter, float k)
+{
+    filter->state = 0;
+    filter->state1 = 0;
+    filter->k = filterFixedGain(k);
+}
+
+void pt2FilterFixedUpdateCutoff(pt2FilterFixed_t *filter, float k)
+{
+    filter->k = filterFixedGain(k);
+}
+
+FAST_CODE int32_t pt2FilterFixedApply(pt2FilterFixed_t *filter, int32_t input)
+{
+    filter->state1 = filterFixedGainApply(filter->k, filter->state1, input);
+    filter->state = filterFixedGainApply(filter->k, filter->state, filter->state1);
+    return filter->state;
+}
+
+void pt3FilterFixedInit(pt3FilterFixed_t *filter, float k)
+{
+    filter->state = 0;
+    filter->state1 = 0;
+    filter->state2 = 0;
+    filter->k = filterFixedGain(k);
+}
+
+void pt3FilterFixedUpdateCutoff(pt3FilterFixed_t *filter, float k)
+{
+    filter->k = filterFixedGain(k);
+}
+
+FAST_CODE int32_t pt3FilterFixedApply(pt3FilterFixed_t *filter, int32_t input)
+{
+    filter->state1 = filterFixedGainApply(filter->k, filter->state1, input);
+    filter->state2 = filterFixedGainApply(filter->k, filter->state2, filter->state1);
+    filter->state = filterFixedGainApply(filter->k, filter->state, filter->state2);
+    return filter->state;
+}
+
+/* The weight of the float coefficients is not carried over, fixed point biquads are always fully applied */
+FAST_CODE void biquadFilterFixedCoeffsFromFloat(biquadFilterFixedCoeffs_t *fixed, const biquadFilterCoeffs_t *coeffs)
+{
+    const float scale = (float)(1 << FILTER_FIXED_COEFF_SHIFT);
+
+    fixed->b0 = lrintf(coeffs->b0 * scale);
+    fixed->b1 = lrintf(coeffs->b1 * scale);
+    fixed->b2 = lrintf(coeffs->b2 * scale);
+    fixed->a1 = lrintf(coeffs->a1 * scale);
+    fixed->a2 = lrintf(coeffs->a2 * scale);
+}
+
+void biquadFilterFixedInit(biquadFilterFixed_t *filter, const biquadFilterFixedCoeffs_t *coeffs)
+{
+    filter->coeffs = coeffs;
+
+    // zero initial samples
+    filter->x1 = filter->x2 = 0;
+    filter->y1 = filter->y2 = 0;
+    filter->error = 0;
+}
+
+FAST_CODE int32_t biquadFilterFixedApply(biquadFilterFixed_t *filter, int32_t input)
+{
+    const biquadFilterFixedCoeffs_t *coeffs = filter->coeffs;
+    const int64_t acc = (int64_t)coeffs->b0 * input + (int64_t)coeffs->b1 * filter->x1 + (int64_t)coeffs->b2 * filter->x2
+        - (int64_t)coeffs->a1 * filter->y1 - (int64_t)coeffs->a2 * filter->y2 + filter->error;
+    const int32_t result = (int32_t)(acc >> FILTER_FIXED_COEFF_SHIFT);
+
+    filter->error = (int32_t)(acc - ((int64_t)result << FILTER_FIXED_COEFF_SHIFT));
+
+    filter->x2 = filter->x1;
+    filter->x1 = input;
+
+    filter->y2 = filter->y1;
+    filter->y1 = result;
+
+    return result;
+}
+
 // Slew filter with limit
 
 void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold)
@@ -178,6 +294,64 @@ void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refresh
 }
 
 FAST_CODE void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight)
+{
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterCoeffsUpdate(&coeffs, filterFreq, refreshRate, Q, filterType, weight);
+
+    filter->b0 = coeffs.b0;
+    filter->b1 = coeffs.b1;
+    filter->b2 = coeffs.b2;
+    filter->a1 = coeffs.a1;
+    filter->a2 = coeffs.a2;
+    filter->weight = coeffs.weight;
+}
+
+FAST_CODE void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterUpdate(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF, 1.0f);
+}
+
+/* Computes a biquadFilter_t filter on a sample (slightly less precise than df2 but works in dynamic mode) */
+FAST_CODE float biquadFilterApplyDF1(biquadFilter_t *filter, float input)
+{
+    /* compute result */
+    const float result = filter->b0 * input + filter->b1 * filter->x1 + filter->b2 * filter->x2 - filter->a1 * filter->y1 - filter->a2 * filter->y2;
+
+    /* shift x1 to x2, input to x1 */
+    filter->x2 = filter->x1;
+    filter->x1 = input;
+
+    /* shift y1 to y2, result to y1 */
+    filter->y2 = filter->y1;
+    filter->y1 = result;
+
+    return result;
+}
+
+/* Computes a biquadFilter_t filter in df1 and crossfades input with output */
+FAST_CODE float biquadFilterApplyDF1Weighted(biquadFilter_t* filter, float input)
+{
+    // compute result
+    const float result = biquadFilterApplyDF1(filter, input);
+
+    // crossfading of input and output to turn filter on/off gradually
+    return filter->weight * result + (1 - filter->weight) * input;
+}
+
+/* Computes a biquadFilter_t filter in direct form 2 on a sample (higher precision but can't handle changes in coefficients */
+FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
+{
+    const float result = filter->b0 * input + filter->x1;
+
+    filter->x1 = filter->b1 * input - filter->a1 * result + filter->x2;
+    filter->x2 = filter->b2 * input - filter->a2 * result;
+
+    return result;
+}
+
+// Biquad with shared coefficients
+
+FAST_CODE void biquadFilterCoeffsUpdate(biquadFilterCoeffs_t *coeffs, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight)
 {
     // setup variables
     const float omega = 2.0f * M_PIf * filterFreq * refreshRate * 0.000001f;
@@ -189,82 +363,199 @@ FAST_CODE void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint
     case FILTER_LPF:
         // 2nd order Butterworth (with Q=1/sqrt(2)) / Butterworth biquad section with Q
         // described in http://www.ti.com/lit/an/slaa447/slaa447.pdf
-        filter->b1 = 1 - cs;
-        filter->b0 = filter->b1 * 0.5f;
-        filter->b2 = filter->b0;
-        filter->a1 = -2 * cs;
-        filter->a2 = 1 - alpha;
+        coeffs->b1 = 1 - cs;
+        coeffs->b0 = coeffs->b1 * 0.5f;
+        coeffs->b2 = coeffs->b0;
+        coeffs->a1 = -2 * cs;
+        coeffs->a2 = 1 - alpha;
         break;
     case FILTER_NOTCH:
-        filter->b0 = 1;
-        filter->b1 = -2 * cs;
-        filter->b2 = 1;
-        filter->a1 = filter->b1;
-        filter->a2 = 1 - alpha;
+        coeffs->b0 = 1;
+        coeffs->b1 = -2 * cs;
+        coeffs->b2 = 1;
+        coeffs->a1 = coeffs->b1;
+        coeffs->a2 = 1 - alpha;
         break;
     case FILTER_BPF:
-        filter->b0 = alpha;
-        filter->b1 = 0;
-        filter->b2 = -alpha;
-        filter->a1 = -2 * cs;
-        filter->a2 = 1 - alpha;
+        coeffs->b0 = alpha;
+        coeffs->b1 = 0;
+        coeffs->b2 = -alpha;
+        coeffs->a1 = -2 * cs;
+        coeffs->a2 = 1 - alpha;
         break;
     }
 
     const float a0 = 1 + alpha;
 
     // precompute the coefficients
-    filter->b0 /= a0;
-    filter->b1 /= a0;
-    filter->b2 /= a0;
-    filter->a1 /= a0;
-    filter->a2 /= a0;
+    coeffs->b0 /= a0;
+    coeffs->b1 /= a0;
+    coeffs->b2 /= a0;
+    coeffs->a1 /= a0;
+    coeffs->a2 /= a0;
 
     // update weight
-    filter->weight = weight;
+    coeffs->weight = weight;
 }
 
-FAST_CODE void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate)
+FAST_CODE void biquadFilterCoeffsUpdateLPF(biquadFilterCoeffs_t *coeffs, float filterFreq, uint32_t refreshRate)
 {
-    biquadFilterUpdate(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF, 1.0f);
+    biquadFilterCoeffsUpdate(coeffs, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF, 1.0f);
 }
 
-/* Computes a biquadFilter_t filter on a sample (slightly less precise than df2 but works in dynamic mode) */
-FAST_CODE float biquadFilterApplyDF1(biquadFilter_t *filter, float input)
+void biquadFilterSharedInit(biquadFilterShared_t *filter, const biquadFilterCoeffs_t *coeffs)
 {
-    /* compute result */
-    const float result = filter->b0 * input + filter->b1 * filter->x1 + filter->b2 * filter->x2 - filter->a1 * filter->y1 - filter->a2 * filter->y2;
+    filter->coeffs = coeffs;
+
+    // zero initial samples
+    filter->x1 = filter->x2 = 0;
+    filter->y1 = filter->y2 = 0;
+}
+
+/* Computes a biquadFilterShared_t filter in direct form 1 (handles changes in the shared coefficients) */
+FAST_CODE float biquadFilterSharedApplyDF1(biquadFilterShared_t *filter, float input)
+{
+    const biquadFilterCoeffs_t *coeffs = filter->coeffs;
+    const float result = coeffs->b0 * input + coeffs->b1 * filter->x1 + coeffs->b2 * filter->x2 - coeffs->a1 * filter->y1 - coeffs->a2 * filter->y2;
 
-    /* shift x1 to x2, input to x1 */
     filter->x2 = filter->x1;
     filter->x1 = input;
 
-    /* shift y1 to y2, result to y1 */
     filter->y2 = filter->y1;
     filter->y1 = result;
 
     return result;
 }
 
-/* Computes a biquadFilter_t filter in df1 and crossfades input with output */
-FAST_CODE float biquadFilterApplyDF1Weighted(biquadFilter_t* filter, float input)
+/* Computes a biquadFilterShared_t filter in direct form 2 (static coefficients only), x1/x2 hold the df2 state */
+FAST_CODE float biquadFilterSharedApply(biquadFilterShared_t *filter, float input)
 {
-    // compute result
-    const float result = biquadFilterApplyDF1(filter, input);
+    const biquadFilterCoeffs_t *coeffs = filter->coeffs;
+    const float result = coeffs->b0 * input + filter->x1;
 
-    // crossfading of input and output to turn filter on/off gradually
-    return filter->weight * result + (1 - filter->weight) * input;
+    filter->x1 = coeffs->b1 * input - coeffs->a1 * result + filter->x2;
+    filter->x2 = coeffs->b2 * input - coeffs->a2 * result;
+
+    return result;
 }
 
-/* Computes a biquadFilter_t filter in direct form 2 on a sample (higher precision but can't handle changes in coefficients */
-FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
+// Notch bank
+
+void biquadNotchBankInit(biquadNotchBank_t *bank, int count)
 {
-    const float result = filter->b0 * input + filter->x1;
+    memset(bank, 0, sizeof(*bank));
+    bank->count = MIN(count, BIQUAD_NOTCH_BANK_SIZE);
+}
 
-    filter->x1 = filter->b1 * input - filter->a1 * result + filter->x2;
-    filter->x2 = filter->b2 * input - filter->a2 * result;
+FAST_CODE void biquadNotchBankUpdate(biquadNotchBank_t *bank, int section, float filterFreq, uint32_t refreshRate, float Q, float weight)
+{
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterCoeffsUpdate(&coeffs, filterFreq, refreshRate, Q, FILTER_NOTCH, weight);
 
-    return result;
+    bank->b0[section] = coeffs.b0;
+    bank->b1[section] = coeffs.b1;
+    bank->a2[section] = coeffs.a2;
+    bank->weight[section] = weight;
+}
+
+/* Runs values[X], values[Y] and values[Z] through every section of the bank in df1 with weighted crossfade.
+   Each section's coefficients are loaded once for all three axes and the arrays are walked linearly */
+FAST_CODE void biquadNotchBankApply(biquadNotchBank_t *bank, float *values)
+{
+    float in0 = values[X];
+    float in1 = values[Y];
+    float in2 = values[Z];
+
+    for (int i = 0; i < bank->count; i++) {
+        const float b0 = bank->b0[i];
+        const float b1 = bank->b1[i];
+        const float a2 = bank->a2[i];
+        const float weight = bank->weight[i];
+        float *x1 = bank->x1[i];
+        float *x2 = bank->x2[i];
+        float *y1 = bank->y1[i];
+        float *y2 = bank->y2[i];
+
+        const float out0 = b0 * (in0 + x2[X]) + b1 * (x1[X] - y1[X]) - a2 * y2[X];
+        const float out1 = b0 * (in1 + x2[Y]) + b1 * (x1[Y] - y1[Y]) - a2 * y2[Y];
+        const float out2 = b0 * (in2 + x2[Z]) + b1 * (x1[Z] - y1[Z]) - a2 * y2[Z];
+
+        x2[X] = x1[X];
+        x2[Y] = x1[Y];
+        x2[Z] = x1[Z];
+        x1[X] = in0;
+        x1[Y] = in1;
+        x1[Z] = in2;
+        y2[X] = y1[X];
+        y2[Y] = y1[Y];
+        y2[Z] = y1[Z];
+        y1[X] = out0;
+        y1[Y] = out1;
+        y1[Z] = out2;
+
+        // crossfading of input and output to turn notch on/off gradually
+        in0 += weight * (out0 - in0);
+        in1 += weight * (out1 - in1);
+        in2 += weight * (out2 - in2);
+    }
+
+    values[X] = in0;
+    values[Y] = in1;
+    values[Z] = in2;
+}
+
+// Notch coefficient table
+
+void biquadNotchTableInit(biquadNotchTable_t *table, float Q)
+{
+    for (int i = 0; i <= BIQUAD_NOTCH_TABLE_SIZE; i++) {
+        // a refresh rate of 1s turns the normalised frequency into Hz
+        biquadFilterCoeffs_t coeffs;
+        biquadFilterCoeffsUpdate(&coeffs, 0.5f * i / BIQUAD_NOTCH_TABLE_SIZE, 1000000, Q, FILTER_NOTCH, 1.0f);
+        table->entry[i].b0 = coeffs.b0;
+        table->entry[i].b1 = coeffs.b1;
+        table->entry[i].a2 = coeffs.a2;
+    }
+}
+
+// fills b0, b1 and a2 of coeffs, the remaining notch coefficients are b2 = b0 and a1 = b1
+FAST_CODE void biquadNotchTableLookup(const biquadNotchTable_t *table, float normalisedFreq, biquadFilterCoeffs_t *coeffs)
+{
+    const float position = constrainf(normalisedFreq, 0.0f, 0.5f) * (2 * BIQUAD_NOTCH_TABLE_SIZE);
+    const int index = MIN((int)position, BIQUAD_NOTCH_TABLE_SIZE - 1);
+    const float fraction = position - index;
+
+    const float b0 = table->entry[index].b0;
+    const float b1 = table->entry[index].b1;
+    const float a2 = table->entry[index].a2;
+
+    coeffs->b0 = b0 + fraction * (table->entry[index + 1].b0 - b0);
+    coeffs->b1 = b1 + fraction * (table->entry[index + 1].b1 - b1);
+    coeffs->a2 = a2 + fraction * (table->entry[index + 1].a2 - a2);
+}
+
+FAST_CODE void biquadFilterUpdateFromNotchTable(biquadFilter_t *filter, const biquadNotchTable_t *table, float normalisedFreq)
+{
+    biquadFilterCoeffs_t coeffs;
+    biquadNotchTableLookup(table, normalisedFreq, &coeffs);
+
+    filter->b0 = coeffs.b0;
+    filter->b1 = coeffs.b1;
+    filter->b2 = coeffs.b0;
+    filter->a1 = coeffs.b1;
+    filter->a2 = coeffs.a2;
+    filter->weight = 1.0f;
+}
+
+FAST_CODE void biquadNotchBankUpdateFromTable(biquadNotchBank_t *bank, int section, const biquadNotchTable_t *table, float normalisedFreq, float weight)
+{
+    biquadFilterCoeffs_t coeffs;
+    biquadNotchTableLookup(table, normalisedFreq, &coeffs);
+
+    bank->b0[section] = coeffs.b0;
+    bank->b1[section] = coeffs.b1;
+    bank->a2[section] = coeffs.a2;
+    bank->weight[section] = weight;
 }
 
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf)
@@ -21,6 +21,8 @@
 #pragma once
 #include <stdbool.h>
 
+#include "common/axis.h"
+
 struct filter_s;
 typedef struct filter_s filter_t;
 
@@ -55,6 +57,80 @@ typedef struct biquadFilter_s {
     float weight;
 } biquadFilter_t;
 
+/* biquad coefficients that can be shared by several biquadFilterShared_t instances */
+typedef struct biquadFilterCoeffs_s {
+    float b0, b1, b2, a1, a2;
+    float weight;
+} biquadFilterCoeffs_t;
+
+/* state-only biquad referencing shared coefficients, updating the coefficients retunes every instance */
+typedef struct biquadFilterShared_s {
+    const biquadFilterCoeffs_t *coeffs;
+    float x1, x2, y1, y2;
+} biquadFilterShared_t;
+
+// enough sections for 8 motors with 3 harmonic notches each
+#define BIQUAD_NOTCH_BANK_SIZE 24
+
+/* cascade of notch sections applied to all three axes at once, stored as structure-of-arrays.
+   Notch coefficients satisfy b2 == b0 and a1 == b1, so only b0, b1 and a2 are kept and are shared by all axes */
+typedef struct biquadNotchBank_s {
+    int count;
+    float b0[BIQUAD_NOTCH_BANK_SIZE];
+    float b1[BIQUAD_NOTCH_BANK_SIZE];
+    float a2[BIQUAD_NOTCH_BANK_SIZE];
+    float weight[BIQUAD_NOTCH_BANK_SIZE];
+    float x1[BIQUAD_NOTCH_BANK_SIZE][XYZ_AXIS_COUNT];
+    float x2[BIQUAD_NOTCH_BANK_SIZE][XYZ_AXIS_COUNT];
+    float y1[BIQUAD_NOTCH_BANK_SIZE][XYZ_AXIS_COUNT];
+    float y2[BIQUAD_NOTCH_BANK_SIZE][XYZ_AXIS_COUNT];
+} biquadNotchBank_t;
+
+#define BIQUAD_NOTCH_TABLE_SIZE 256
+
+/* notch coefficients for one Q, tabulated over normalised frequency (filterFreq * sample time) from 0 to nyquist.
+   Linear interpolation between entries replaces the sin/cos and divisions of a full coefficient update */
+typedef struct biquadNotchTable_s {
+    struct {
+        float b0, b1, a2;
+    } entry[BIQUAD_NOTCH_TABLE_SIZE + 1];
+} biquadNotchTable_t;
+
+/* fixed point filters for targets without FPU headroom.
+   Samples are Q16.16, pt gains Q31 and biquad coefficients Q30 */
+#define FILTER_FIXED_SAMPLE_SHIFT 16
+#define FILTER_FIXED_GAIN_SHIFT 31
+#define FILTER_FIXED_COEFF_SHIFT 30
+
+typedef struct pt1FilterFixed_s {
+    int32_t state;
+    int32_t k;
+} pt1FilterFixed_t;
+
+typedef struct pt2FilterFixed_s {
+    int32_t state;
+    int32_t state1;
+    int32_t k;
+} pt2FilterFixed_t;
+
+typedef struct pt3FilterFixed_s {
+    int32_t state;
+    int32_t state1;
+    int32_t state2;
+    int32_t k;
+} pt3FilterFixed_t;
+
+typedef struct biquadFilterFixedCoeffs_s {
+    int32_t b0, b1, b2, a1, a2;
+} biquadFilterFixedCoeffs_t;
+
+/* direct form 1 with the rounding error of each output fed back into the next one */
+typedef struct biquadFilterFixed_s {
+    const biquadFilterFixedCoeffs_t *coeffs;
+    int32_t x1, x2, y1, y2;
+    int32_t error;
+} biquadFilterFixed_t;
+
 typedef struct laggedMovingAverage_s {
     uint16_t movingWindowIndex;
     uint16_t windowSize;
@@ -77,6 +153,7 @@ typedef enum {
 } biquadFilterType_e;
 
 typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+typedef int32_t (*filterFixedApplyFnPtr)(filter_t *filter, int32_t input);
 
 float nullFilterApply(filter_t *filter, float input);
 
@@ -88,8 +165,23 @@ void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t re
 float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
 float biquadFilterApplyDF1Weighted(biquadFilter_t *filter, float input);
 float biquadFilterApply(biquadFilter_t *filter, float input);
+
+void biquadFilterCoeffsUpdate(biquadFilterCoeffs_t *coeffs, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight);
+void biquadFilterCoeffsUpdateLPF(biquadFilterCoeffs_t *coeffs, float filterFreq, uint32_t refreshRate);
+void biquadFilterSharedInit(biquadFilterShared_t *filter, const biquadFilterCoeffs_t *coeffs);
+float biquadFilterSharedApplyDF1(biquadFilterShared_t *filter, float input);
+float biquadFilterSharedApply(biquadFilterShared_t *filter, float input);
 float filterGetNotchQ(float centerFreq, float cutoffFreq);
 
+void biquadNotchBankInit(biquadNotchBank_t *bank, int count);
+void biquadNotchBankUpdate(biquadNotchBank_t *bank, int section, float filterFreq, uint32_t refreshRate, float Q, float weight);
+void biquadNotchBankApply(biquadNotchBank_t *bank, float *values);
+
+void biquadNotchTableInit(biquadNotchTable_t *table, float Q);
+void biquadNotchTableLookup(const biquadNotchTable_t *table, float normalisedFreq, biquadFilterCoeffs_t *coeffs);
+void biquadFilterUpdateFromNotchTable(biquadFilter_t *filter, const biquadNotchTable_t *table, float normalisedFreq);
+void biquadNotchBankUpdateFromTable(biquadNotchBank_t *bank, int section, const biquadNotchTable_t *table, float normalisedFreq, float weight);
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
 float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
 
@@ -111,6 +203,34 @@ float pt3FilterApply(pt3Filter_t *filter, float input);
 void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
 float slewFilterApply(slewFilter_t *filter, float input);
 
+static inline int32_t filterFixedFromFloat(float value)
+{
+    return (int32_t)(value * (float)(1 << FILTER_FIXED_SAMPLE_SHIFT));
+}
+
+static inline float filterFixedToFloat(int32_t value)
+{
+    return value * (1.0f / (1 << FILTER_FIXED_SAMPLE_SHIFT));
+}
+
+int32_t nullFilterFixedApply(filter_t *filter, int32_t input);
+
+void pt1FilterFixedInit(pt1FilterFixed_t *filter, float k);
+void pt1FilterFixedUpdateCutoff(pt1FilterFixed_t *filter, float k);
+int32_t pt1FilterFixedApply(pt1FilterFixed_t *filter, int32_t input);
+
+void pt2FilterFixedInit(pt2FilterFixed_t *filter, float k);
+void pt2FilterFixedUpdateCutoff(pt2FilterFixed_t *filter, float k);
+int32_t pt2FilterFixedApply(pt2FilterFixed_t *filter, int32_t input);
+
+void pt3FilterFixedInit(pt3FilterFixed_t *filter, float k);
+void pt3FilterFixedUpdateCutoff(pt3FilterFixed_t *filter, float k);
+int32_t pt3FilterFixedApply(pt3FilterFixed_t *filter, int32_t input);
+
+void biquadFilterFixedCoeffsFromFloat(biquadFilterFixedCoeffs_t *fixed, const biquadFilterCoeffs_t *coeffs);
+void biquadFilterFixedInit(biquadFilterFixed_t *filter, const biquadFilterFixedCoeffs_t *coeffs);
+int32_t biquadFilterFixedApply(biquadFilterFixed_t *filter, int32_t input);
+
 typedef struct simpleLowpassFilter_s {
     int32_t fp;
     int32_t beta;
@@ -28,40 +28,86 @@
 
 #define SDFT_R 0.9999f  // damping factor for guaranteed SDFT stability (r < 1.0f) 
 
-static FAST_DATA_ZERO_INIT float     rPowerN;  // SDFT_R to the power of SDFT_SAMPLE_SIZE
-static FAST_DATA_ZERO_INIT bool      isInitialized;
-static FAST_DATA_ZERO_INIT complex_t twiddle[SDFT_BIN_COUNT];
+typedef struct sdftTwiddle_s {
+
+    bool isInitialized;
+    float rPowerN;          // SDFT_R to the power of sample size
+    complex_t *twiddle;
+
+} sdftTwiddle_t;
+
+static FAST_DATA_ZERO_INIT complex_t twiddle48[48 / 2];
+static FAST_DATA_ZERO_INIT complex_t twiddle72[72 / 2];
+static FAST_DATA_ZERO_INIT complex_t twiddle96[96 / 2];
+static FAST_DATA_ZERO_INIT complex_t twiddle128[128 / 2];
+
+static const uint8_t sdftSampleSizes[SDFT_SIZE_COUNT] = { 48, 72, 96, 128 };
+
+// twiddle factors are only calculated for the sizes in use
+static sdftTwiddle_t sdftTwiddles[SDFT_SIZE_COUNT] = {
+    { .twiddle = twiddle48 },
+    { .twiddle = twiddle72 },
+    { .twiddle = twiddle96 },
+    { .twiddle = twiddle128 },
+};
 
 static void applySqrt(const sdft_t *sdft, float *data);
 
 
-void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numBatches)
+int sdftSampleSize(const sdftSize_e size)
 {
-    if (!isInitialized) {
-        rPowerN = powf(SDFT_R, SDFT_SAMPLE_SIZE);
-        const float c = 2.0f * M_PIf / (float)SDFT_SAMPLE_SIZE;
+    return sdftSampleSizes[size < SDFT_SIZE_COUNT ? size : SDFT_SIZE_72];
+}
+
+
+int sdftBinCount(const sdftSize_e size)
+{
+    return sdftSampleSize(size) / 2;
+}
+
+
+static const sdftTwiddle_t *initTwiddle(const sdftSize_e size)
+{
+    sdftTwiddle_t *twiddle = &sdftTwiddles[size < SDFT_SIZE_COUNT ? size : SDFT_SIZE_72];
+
+    if (!twiddle->isInitialized) {
+        const int sampleSize = sdftSampleSize(size);
+        twiddle->rPowerN = powf(SDFT_R, sampleSize);
+        const float c = 2.0f * M_PIf / (float)sampleSize;
         float phi = 0.0f;
-        for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        for (int i = 0; i < sampleSize / 2; i++) {
             phi = c * i;
-            twiddle[i] = SDFT_R * (cos_approx(phi) + _Complex_I * sin_approx(phi));
+            twiddle->twiddle[i] = SDFT_R * (cos_approx(phi) + _Complex_I * sin_approx(phi));
         }
-        isInitialized = true;
+        twiddle->isInitialized = true;
     }
 
+    return twiddle;
+}
+
+
+void sdftInit(sdft_t *sdft, const sdftSize_e size, const int startBin, const int endBin, const int numBatches)
+{
+    const sdftTwiddle_t *twiddle = initTwiddle(size);
+    const int binCount = sdftBinCount(size);
+
     sdft->idx = 0;
+    sdft->sampleSize = sdftSampleSize(size);
+    sdft->rPowerN = twiddle->rPowerN;
+    sdft->twiddle = twiddle->twiddle;
 
     // Add 1 bin on either side outside of range (if possible) to get proper windowing up to range limits
-    sdft->startBin = constrain(startBin - 1, 0, SDFT_BIN_COUNT - 1);
-    sdft->endBin = constrain(endBin + 1, sdft->startBin, SDFT_BIN_COUNT - 1);
+    sdft->startBin = constrain(startBin - 1, 0, binCount - 1);
+    sdft->endBin = constrain(endBin + 1, sdft->startBin, binCount - 1);
 
     sdft->numBatches = MAX(numBatches, 1);
     sdft->batchSize = (sdft->endBin - sdft->startBin) / sdft->numBatches + 1;  // batchSize = ceil(numBins / numBatches)
 
-    for (int i = 0; i < SDFT_SAMPLE_SIZE; i++) {
+    for (int i = 0; i < SDFT_SAMPLE_SIZE_MAX; i++) {
         sdft->samples[i] = 0.0f;
     }
 
-    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+    for (int i = 0; i < SDFT_BIN_COUNT_MAX; i++) {
         sdft->data[i] = 0.0f;
     }
 }
@@ -70,35 +116,39 @@ void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numB
 // Add new sample to frequency spectrum
 FAST_CODE void sdftPush(sdft_t *sdft, const float sample)
 {
-    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+    const float delta = sample - sdft->rPowerN * sdft->samples[sdft->idx];
     
     sdft->samples[sdft->idx] = sample;
-    sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+    if (++sdft->idx == sdft->sampleSize) {
+        sdft->idx = 0;
+    }
 
     for (int i = sdft->startBin; i <= sdft->endBin; i++) {
-        sdft->data[i] = twiddle[i] * (sdft->data[i] + delta);
+        sdft->data[i] = sdft->twiddle[i] * (sdft->data[i] + delta);
     }
 }
 
 
-// Add new sample to frequency spectrum in parts
+// Add new sample to frequency spectrum in parts, batches only cover startBin..endBin
 FAST_CODE void sdftPushBatch(sdft_t* sdft, const float sample, const int batchIdx)
 {
-    const int batchStart = sdft->batchSize * batchIdx;
+    const int batchStart = sdft->startBin + sdft->batchSize * batchIdx;
     int batchEnd = batchStart;
 
-    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+    const float delta = sample - sdft->rPowerN * sdft->samples[sdft->idx];
 
     if (batchIdx == sdft->numBatches - 1) {
         sdft->samples[sdft->idx] = sample;
-        sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
-        batchEnd += sdft->endBin - batchStart + 1;
+        if (++sdft->idx == sdft->sampleSize) {
+            sdft->idx = 0;
+        }
+        batchEnd = sdft->endBin + 1;
     } else {
-        batchEnd += sdft->batchSize;
+        batchEnd = MIN(batchStart + sdft->batchSize, sdft->endBin + 1);
     }
 
     for (int i = batchStart; i < batchEnd; i++) {
-        sdft->data[i] = twiddle[i] * (sdft->data[i] + delta);
+        sdft->data[i] = sdft->twiddle[i] * (sdft->data[i] + delta);
     }
 }
 
@@ -157,3 +207,78 @@ static FAST_CODE void applySqrt(const sdft_t *sdft, float *data)
         data[i] = sqrtf(data[i]);
     }
 }
+
+
+void sdftAxesInit(sdftAxes_t *sdft, const sdftSize_e size, const int startBin, const int endBin, const int numBatches)
+{
+    const sdftTwiddle_t *twiddle = initTwiddle(size);
+    const int binCount = sdftBinCount(size);
+
+    sdft->idx = 0;
+    sdft->sampleSize = sdftSampleSize(size);
+    sdft->rPowerN = twiddle->rPowerN;
+    sdft->twiddle = twiddle->twiddle;
+
+    // Add 1 bin on either side outside of range (if possible) to get proper windowing up to range limits
+    sdft->startBin = constrain(startBin - 1, 0, binCount - 1);
+    sdft->endBin = constrain(endBin + 1, sdft->startBin, binCount - 1);
+
+    sdft->numBatches = MAX(numBatches, 1);
+    sdft->batchSize = (sdft->endBin - sdft->startBin) / sdft->numBatches + 1;  // batchSize = ceil(numBins / numBatches)
+
+    for (int i = 0; i < SDFT_SAMPLE_SIZE_MAX; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sdft->samples[i][axis] = 0.0f;
+        }
+    }
+
+    for (int i = 0; i < SDFT_BIN_COUNT_MAX; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sdft->data[i][axis] = 0.0f;
+        }
+    }
+}
+
+
+// Add one new sample per axis to the frequency spectra in parts, batches only cover startBin..endBin
+FAST_CODE void sdftAxesPushBatch(sdftAxes_t *sdft, const float *samples, const int batchIdx)
+{
+    const int batchStart = sdft->startBin + sdft->batchSize * batchIdx;
+    const int batchEnd = (batchIdx == sdft->numBatches - 1) ? sdft->endBin + 1 : MIN(batchStart + sdft->batchSize, sdft->endBin + 1);
+
+    float *oldest = sdft->samples[sdft->idx];
+    const float deltaX = samples[X] - sdft->rPowerN * oldest[X];
+    const float deltaY = samples[Y] - sdft->rPowerN * oldest[Y];
+    const float deltaZ = samples[Z] - sdft->rPowerN * oldest[Z];
+
+    if (batchIdx == sdft->numBatches - 1) {
+        oldest[X] = samples[X];
+        oldest[Y] = samples[Y];
+        oldest[Z] = samples[Z];
+        if (++sdft->idx == sdft->sampleSize) {
+            sdft->idx = 0;
+        }
+    }
+
+    for (int i = batchStart; i < batchEnd; i++) {
+        const complex_t w = sdft->twiddle[i];
+        complex_t *bin = sdft->data[i];
+        bin[X] = w * (bin[X] + deltaX);
+        bin[Y] = w * (bin[Y] + deltaY);
+        bin[Z] = w * (bin[Z] + deltaZ);
+    }
+}
+
+
+// Get squared magnitude of the frequency spectra with Hann window applied, output is indexed [axis][bin]
+FAST_CODE void sdftAxesWinSq(const sdftAxes_t *sdft, float output[XYZ_AXIS_COUNT][SDFT_BIN_COUNT_MAX])
+{
+    for (int i = (sdft->startBin + 1); i < sdft->endBin; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const complex_t val = sdft->data[i][axis] - 0.5f * (sdft->data[i - 1][axis] + sdft->data[i + 1][axis]); // multiply by 2 to save one multiplication
+            const float re = crealf(val);
+            const float im = cimagf(val);
+            output[axis][i] = re * re + im * im;
+        }
+    }
+}
@@ -25,28 +25,67 @@
 
 #include <stdint.h>
 #include <complex.h>
+
+#include "common/axis.h"
+
 #undef I  // avoid collision of imaginary unit I with variable I in pid.h
 typedef float complex complex_t; // Better readability for type "float complex"
 
-#define SDFT_SAMPLE_SIZE 72
-#define SDFT_BIN_COUNT   (SDFT_SAMPLE_SIZE / 2)
+// Supported SDFT sizes, storage is always reserved for the largest one
+typedef enum {
+    SDFT_SIZE_48 = 0,
+    SDFT_SIZE_72,
+    SDFT_SIZE_96,
+    SDFT_SIZE_128,
+    SDFT_SIZE_COUNT
+} sdftSize_e;
+
+#define SDFT_SAMPLE_SIZE_MAX 128
+#define SDFT_BIN_COUNT_MAX   (SDFT_SAMPLE_SIZE_MAX / 2)
 
 typedef struct sdft_s {
 
-    int idx;                           // circular buffer index
+    int idx;                               // circular buffer index
+    int sampleSize;
     int startBin;
     int endBin;
     int batchSize;
     int numBatches;
-    float samples[SDFT_SAMPLE_SIZE];   // circular buffer
-    complex_t data[SDFT_BIN_COUNT];    // complex frequency spectrum
+    float rPowerN;                         // damping factor to the power of sampleSize
+    const complex_t *twiddle;              // twiddle factors for sampleSize
+    float samples[SDFT_SAMPLE_SIZE_MAX];   // circular buffer
+    complex_t data[SDFT_BIN_COUNT_MAX];    // complex frequency spectrum
 
 } sdft_t;
 
-void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numBatches);
+// SDFT of all three gyro axes with samples and bins interleaved by axis,
+// so every twiddle factor is loaded once and applied to X, Y and Z in a row
+typedef struct sdftAxes_s {
+
+    int idx;                                                 // circular buffer index
+    int sampleSize;
+    int startBin;
+    int endBin;
+    int batchSize;
+    int numBatches;
+    float rPowerN;                                           // damping factor to the power of sampleSize
+    const complex_t *twiddle;                                // twiddle factors for sampleSize
+    float samples[SDFT_SAMPLE_SIZE_MAX][XYZ_AXIS_COUNT];     // circular buffer
+    complex_t data[SDFT_BIN_COUNT_MAX][XYZ_AXIS_COUNT];      // complex frequency spectrum
+
+} sdftAxes_t;
+
+int sdftSampleSize(const sdftSize_e size);
+int sdftBinCount(const sdftSize_e size);
+
+void sdftInit(sdft_t *sdft, const sdftSize_e size, const int startBin, const int endBin, const int numBatches);
 void sdftPush(sdft_t *sdft, const float sample);
 void sdftPushBatch(sdft_t *sdft, const float sample, const int batchIdx);
 void sdftMagSq(const sdft_t *sdft, float *output);
 void sdftMagnitude(const sdft_t *sdft, float *output);
 void sdftWinSq(const sdft_t *sdft, float *output);
 void sdftWindow(const sdft_t *sdft, float *output);
+
+void sdftAxesInit(sdftAxes_t *sdft, const sdftSize_e size, const int startBin, const int endBin, const int numBatches);
+void sdftAxesPushBatch(sdftAxes_t *sdft, const float *samples, const int batchIdx);
+void sdftAxesWinSq(const sdftAxes_t *sdft, float output[XYZ_AXIS_COUNT][SDFT_BIN_COUNT_MAX]);
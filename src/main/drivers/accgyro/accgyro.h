@@ -30,6 +30,7 @@
 #include "drivers/bus.h"
 #include "drivers/sensor.h"
 #include "drivers/accgyro/accgyro_mpu.h"
+#include "drivers/accgyro/gyro_fifo.h"
 
 #pragma GCC diagnostic push
 #if defined(SIMULATOR_BUILD) && defined(SIMULATOR_MULTITHREAD)
@@ -124,6 +125,9 @@ typedef struct gyroDev_s {
     int32_t gyroShortPeriod;
     int32_t gyroDmaMaxDuration;
     busSegment_t segments[2];
+#endif
+#ifdef USE_GYRO_FIFO_BATCH
+    gyroFifo_t fifo;
 #endif
     volatile bool dataReady;
     bool gyro_high_fsr;
@@ -224,7 +224,15 @@ bool mpuGyroRead(gyroDev_t *gyro)
 #ifdef USE_SPI_GYRO
 bool mpuAccReadSPI(accDev_t *acc)
 {
-    switch (acc->gyro->gyroModeSPI) {
+    gyroModeSPI_e gyroModeSPI = acc->gyro->gyroModeSPI;
+#ifdef USE_GYRO_FIFO_BATCH
+    // The EXTI triggered burst only reads the FIFO so the acc has to be read on demand
+    if (gyroModeSPI == GYRO_EXTI_INT_DMA && gyroFifoIsBatching(&acc->gyro->fifo)) {
+        gyroModeSPI = GYRO_EXTI_INT;
+    }
+#endif
+
+    switch (gyroModeSPI) {
     case GYRO_EXTI_INT:
     case GYRO_EXTI_NO_INT:
     {
@@ -38,8 +38,6 @@
 #include "drivers/system.h"
 #include "drivers/time.h"
 
-#define BMI270_FIFO_FRAME_SIZE 6
-
 // Need to see at least this many interrupts during initialisation to confirm EXTI connectivity
 #define GYRO_EXTI_DETECT_THRESHOLD 1000
 
@@ -86,7 +84,15 @@ void bmi270ExtiHandler(extiCallbackRec_t *cb)
 
 bool bmi270AccRead(accDev_t *acc)
 {
-    switch (acc->gyro->gyroModeSPI) {
+    gyroModeSPI_e gyroModeSPI = acc->gyro->gyroModeSPI;
+#ifdef USE_GYRO_FIFO_BATCH
+    // The EXTI triggered burst only reads the FIFO so the acc has to be read on demand
+    if (gyroModeSPI == GYRO_EXTI_INT_DMA && gyroFifoIsBatching(&acc->gyro->fifo)) {
+        gyroModeSPI = GYRO_EXTI_INT;
+    }
+#endif
+
+    switch (gyroModeSPI) {
     case GYRO_EXTI_INT:
     case GYRO_EXTI_NO_INT:
     {
@@ -129,6 +135,12 @@ bool bmi270AccRead(accDev_t *acc)
     return true;
 }
 
+static int16_t bmi270GyroCasCompensate(int16_t gyroX, int16_t gyroZ)
+{
+    // only x axis need overflow check
+    return constrain(gyroX - (int16_t)(bmi270CasFactor * gyroZ / 512), INT16_MIN, INT16_MAX);
+}
+
 bool bmi270GyroReadRegister(gyroDev_t *gyro)
 {
     int16_t *gyroData = (int16_t *)gyro->dev.rxBuf;
@@ -183,15 +195,7 @@ bool bmi270GyroReadRegister(gyroDev_t *gyro)
         // Wait for completion
         spiWait(&gyro->dev);
 
-        // only x axis need overflow check
-        int32_t tempx = gyroData[1] - (int16_t)(bmi270CasFactor * (int16_t)(gyroData[3]) / 512);
-        if (tempx > 32767) {
-            gyro->gyroADCRaw[X] = 32767;
-        } else if (tempx < -32768) {
-            gyro->gyroADCRaw[X] = -32768;
-        } else {
-            gyro->gyroADCRaw[X] = tempx;
-        }
+        gyro->gyroADCRaw[X] = bmi270GyroCasCompensate(gyroData[1], gyroData[3]);
         gyro->gyroADCRaw[Y] = gyroData[2];
         gyro->gyroADCRaw[Z] = gyroData[3];
 
@@ -200,14 +204,7 @@ bool bmi270GyroReadRegister(gyroDev_t *gyro)
 
     case GYRO_EXTI_INT_DMA:
     {
-        int32_t tempx = gyroData[4] - (int16_t)(bmi270CasFactor * (int16_t)(gyroData[6]) / 512);
-        if (tempx > 32767) {
-            gyro->gyroADCRaw[X] = 32767;
-        } else if (tempx < -32768) {
-            gyro->gyroADCRaw[X] = -32768;
-        } else {
-            gyro->gyroADCRaw[X] = tempx;
-        }
+        gyro->gyroADCRaw[X] = bmi270GyroCasCompensate(gyroData[4], gyroData[6]);
         gyro->gyroADCRaw[Y] = gyroData[5];
         gyro->gyroADCRaw[Z] = gyroData[6];
 
@@ -284,8 +281,78 @@ bool bmi270GyroReadFifo(gyroDev_t *gyro)
 }
 #endif
 
+#ifdef USE_GYRO_FIFO_BATCH
+// Decodes a burst of up to batchSize headerless gyro frames read from the FIFO on the watermark interrupt
+static bool bmi270GyroReadFifoBatch(gyroDev_t *gyro)
+{
+    gyroFifo_t *fifo = &gyro->fifo;
+
+    if (gyro->gyroModeSPI == GYRO_EXTI_INIT) {
+        // Let the register read decide on EXTI and DMA, then retarget the DMA transfer at the FIFO
+        bmi270GyroReadRegister(gyro);
+        if (gyro->gyroModeSPI == GYRO_EXTI_INT_DMA) {
+            gyroFifoStartDma(gyro);
+        }
+        return false;
+    }
+
+    const uint8_t *rxBuf = gyroFifoRead(gyro);
+    if (!rxBuf) {
+        return false;
+    }
+
+    // The burst starts with the FIFO length and is followed by the frames, see bmi270GyroReadFifo()
+    const int fifoLength = (uint16_t)((rxBuf[3] << 8) | rxBuf[2]);
+    const int frameCount = MIN(fifoLength / BMI270_FIFO_FRAME_SIZE, fifo->batchSize);
+    int sampleCount = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        const uint8_t *frame = &rxBuf[BMI270_FIFO_HEADER_SIZE + i * BMI270_FIFO_FRAME_SIZE];
+        const int16_t gyroX = (int16_t)((frame[1] << 8) | frame[0]);
+        const int16_t gyroY = (int16_t)((frame[3] << 8) | frame[2]);
+        const int16_t gyroZ = (int16_t)((frame[5] << 8) | frame[4]);
+
+        // Invalid frames read as 0x8000 on all axes
+        if ((gyroX == INT16_MIN) && (gyroY == INT16_MIN) && (gyroZ == INT16_MIN)) {
+            fifo->droppedFrames++;
+            continue;
+        }
+
+        fifo->samples[sampleCount][X] = bmi270GyroCasCompensate(gyroX, gyroZ);
+        fifo->samples[sampleCount][Y] = gyroY;
+        fifo->samples[sampleCount][Z] = gyroZ;
+        sampleCount++;
+    }
+
+    // A whole batch left behind means the reads have fallen behind the sensor, and a partial frame would
+    // never be removed from the queue. Either way start again from an empty FIFO.
+    const int remaining = fifoLength - frameCount * BMI270_FIFO_FRAME_SIZE;
+    if (remaining >= fifo->batchSize * BMI270_FIFO_FRAME_SIZE || (remaining % BMI270_FIFO_FRAME_SIZE)) {
+        spiWriteReg(&gyro->dev, BMI270_REG_CMD, 0xB0);
+        fifo->droppedFrames += remaining / BMI270_FIFO_FRAME_SIZE;
+    }
+
+    gyroFifoCompleteBatch(fifo, sampleCount);
+
+    if (sampleCount == 0) {
+        return false;
+    }
+
+    gyro->gyroADCRaw[X] = fifo->samples[sampleCount - 1][X];
+    gyro->gyroADCRaw[Y] = fifo->samples[sampleCount - 1][Y];
+    gyro->gyroADCRaw[Z] = fifo->samples[sampleCount - 1][Z];
+
+    return true;
+}
+#endif
+
 bool bmi270GyroRead(gyroDev_t *gyro)
 {
+#ifdef USE_GYRO_FIFO_BATCH
+    if (gyroFifoIsBatching(&gyro->fifo)) {
+        return bmi270GyroReadFifoBatch(gyro);
+    }
+#endif
 #ifdef USE_GYRO_DLPF_EXPERIMENTAL
     if (gyro->hardware_lpf == GYRO_HARDWARE_LPF_EXPERIMENTAL) {
         // running in 6.4KHz FIFO mode
@@ -76,6 +76,9 @@ typedef enum {
     BMI270_REG_CMD = 0x7E,
 } bmi270Register_e;
 
+#define BMI270_FIFO_FRAME_SIZE 6        // headerless gyro only frame
+#define BMI270_FIFO_HEADER_SIZE 4       // register address, dummy byte and FIFO length ahead of the first frame
+
 extern int8_t bmi270CasFactor;
 // Contained in accgyro_spi_bmi270_init.c which is size-optimized
 uint8_t bmi270Detect(const extDevice_t *dev);
@@ -94,6 +94,7 @@ typedef enum {
     BMI270_VAL_FIFO_CONFIG_0 = 0x00,                    // don't stop when full, disable sensortime frame
     BMI270_VAL_FIFO_CONFIG_1 = 0x80,                    // only gyro data in FIFO, use headerless mode
     BMI270_VAL_FIFO_DOWNS = 0x00,                       // select unfiltered gyro data with no downsampling (6.4KHz samples)
+    BMI270_VAL_FIFO_DOWNS_FILTERED = 0x80,              // select filtered gyro data with no downsampling
     BMI270_VAL_FIFO_WTM_0 = 0x06,                       // set the FIFO watermark level to 1 gyro sample (6 bytes)
     BMI270_VAL_FIFO_WTM_1 = 0x00,                       // FIFO watermark MSB
     BMI270_VAL_GEN_SET_1 = 0x0200,                      // bit 9, enable self offset correction (IOC part 1)
@@ -311,10 +312,17 @@ static void bmi270Config(gyroDev_t *gyro)
     // If running in hardware_lpf experimental mode then switch to FIFO-based,
     // 6.4KHz sampling, unfiltered data vs. the default 3.2KHz with hardware filtering
 #ifdef USE_GYRO_DLPF_EXPERIMENTAL
-    const bool fifoMode = (gyro->hardware_lpf == GYRO_HARDWARE_LPF_EXPERIMENTAL);
+    const bool unfilteredMode = (gyro->hardware_lpf == GYRO_HARDWARE_LPF_EXPERIMENTAL);
 #else
-    const bool fifoMode = false;
+    const bool unfilteredMode = false;
 #endif
+    // FIFO batching reads several samples per watermark interrupt
+#ifdef USE_GYRO_FIFO_BATCH
+    const uint8_t fifoBatchSize = gyro->fifo.batchSize;
+#else
+    const uint8_t fifoBatchSize = 1;
+#endif
+    const bool fifoMode = unfilteredMode || fifoBatchSize > 1;
 
     // Perform a soft reset to set all configuration to default
     // Delay 100ms before continuing configuration
@@ -338,8 +346,8 @@ static void bmi270Config(gyroDev_t *gyro)
     if (fifoMode) {
         bmi270RegisterWrite(dev, BMI270_REG_FIFO_CONFIG_0, BMI270_VAL_FIFO_CONFIG_0, 1);
         bmi270RegisterWrite(dev, BMI270_REG_FIFO_CONFIG_1, BMI270_VAL_FIFO_CONFIG_1, 1);
-        bmi270RegisterWrite(dev, BMI270_REG_FIFO_DOWNS, BMI270_VAL_FIFO_DOWNS, 1);
-        bmi270RegisterWrite(dev, BMI270_REG_FIFO_WTM_0, BMI270_VAL_FIFO_WTM_0, 1);
+        bmi270RegisterWrite(dev, BMI270_REG_FIFO_DOWNS, unfilteredMode ? BMI270_VAL_FIFO_DOWNS : BMI270_VAL_FIFO_DOWNS_FILTERED, 1);
+        bmi270RegisterWrite(dev, BMI270_REG_FIFO_WTM_0, BMI270_VAL_FIFO_WTM_0 * fifoBatchSize, 1);
         bmi270RegisterWrite(dev, BMI270_REG_FIFO_WTM_1, BMI270_VAL_FIFO_WTM_1, 1);
     }
 
@@ -384,6 +392,12 @@ static void bmi270Config(gyroDev_t *gyro)
     uint8_t casRaw = bmi270RegisterRead(dev, BMI270_REG_FEATURES_0_GYR_CAS);
 
     bmi270CasFactor = bmi270ProcessGyroCas(casRaw);
+
+#ifdef USE_GYRO_FIFO_BATCH
+    if (fifoBatchSize > 1) {
+        gyroFifoConfigure(&gyro->fifo, BMI270_REG_FIFO_LENGTH_LSB | 0x80, BMI270_FIFO_HEADER_SIZE, BMI270_FIFO_FRAME_SIZE, gyro->gyroSampleRateHz);
+    }
+#endif
 }
 
 #ifdef USE_GYRO_EXTI
@@ -91,6 +91,25 @@
 #define ICM426XX_RA_INT_SOURCE0                     0x65
 #define ICM426XX_UI_DRDY_INT1_EN_DISABLED           (0 << 3)
 #define ICM426XX_UI_DRDY_INT1_EN_ENABLED            (1 << 3)
+#define ICM426XX_FIFO_THS_INT1_EN_ENABLED           (1 << 2)
+
+#define ICM426XX_RA_FIFO_CONFIG                     0x16
+#define ICM426XX_FIFO_MODE_STREAM                   (1 << 6)
+
+#define ICM426XX_RA_FIFO_COUNTH                     0x2E
+
+#define ICM426XX_RA_SIGNAL_PATH_RESET               0x4B
+#define ICM426XX_FIFO_FLUSH                         (1 << 1)
+
+#define ICM426XX_RA_FIFO_CONFIG1                    0x5F
+#define ICM426XX_FIFO_GYRO_EN                       (1 << 1)
+#define ICM426XX_RA_FIFO_CONFIG2                    0x60    // watermark in bytes, bits [7:0]
+#define ICM426XX_RA_FIFO_CONFIG3                    0x61    // watermark in bytes, bits [11:8]
+
+#define ICM426XX_FIFO_HEADER_SIZE                   3       // register address and big endian FIFO count ahead of the first packet
+#define ICM426XX_FIFO_FRAME_SIZE                    8       // packet 2: header, gyro data and temperature
+#define ICM426XX_FIFO_HEADER_EMPTY                  (1 << 7)
+#define ICM426XX_FIFO_HEADER_GYRO                   (1 << 5)
 
 uint8_t icm426xxSpiDetect(const extDevice_t *dev)
 {
@@ -202,8 +221,25 @@ void icm426xxGyroInit(gyroDev_t *gyro)
     spiWriteReg(dev, ICM426XX_RA_INT_CONFIG, ICM426XX_INT1_MODE_PULSED | ICM426XX_INT1_DRIVE_CIRCUIT_PP | ICM426XX_INT1_POLARITY_ACTIVE_HIGH);
     spiWriteReg(dev, ICM426XX_RA_INT_CONFIG0, ICM426XX_UI_DRDY_INT_CLEAR_ON_SBR);
 
+#ifdef USE_GYRO_FIFO_BATCH
+    const bool fifoBatch = gyro->fifo.batchSize > 1;
+    if (fifoBatch) {
+        // Stream gyro only packets, the watermark interrupt fires once per batch
+        const uint16_t watermark = gyro->fifo.batchSize * ICM426XX_FIFO_FRAME_SIZE;
+        spiWriteReg(dev, ICM426XX_RA_FIFO_CONFIG1, ICM426XX_FIFO_GYRO_EN);
+        spiWriteReg(dev, ICM426XX_RA_FIFO_CONFIG2, watermark & 0xFF);
+        spiWriteReg(dev, ICM426XX_RA_FIFO_CONFIG3, watermark >> 8);
+        spiWriteReg(dev, ICM426XX_RA_FIFO_CONFIG, ICM426XX_FIFO_MODE_STREAM);
+        spiWriteReg(dev, ICM426XX_RA_SIGNAL_PATH_RESET, ICM426XX_FIFO_FLUSH);
+
+        gyroFifoConfigure(&gyro->fifo, ICM426XX_RA_FIFO_COUNTH | 0x80, ICM426XX_FIFO_HEADER_SIZE, ICM426XX_FIFO_FRAME_SIZE, gyro->gyroSampleRateHz);
+    }
+#else
+    const bool fifoBatch = false;
+#endif
+
 #ifdef USE_MPU_DATA_READY_SIGNAL
-    spiWriteReg(dev, ICM426XX_RA_INT_SOURCE0, ICM426XX_UI_DRDY_INT1_EN_ENABLED);
+    spiWriteReg(dev, ICM426XX_RA_INT_SOURCE0, fifoBatch ? ICM426XX_FIFO_THS_INT1_EN_ENABLED : ICM426XX_UI_DRDY_INT1_EN_ENABLED);
 
     uint8_t intConfig1Value = spiReadRegMsk(dev, ICM426XX_RA_INT_CONFIG1);
     // Datasheet says: "User should change setting to 0 from default setting of 1, for proper INT1 and INT2 pin operation"
@@ -214,6 +250,75 @@ void icm426xxGyroInit(gyroDev_t *gyro)
 #endif
 }
 
+#ifdef USE_GYRO_FIFO_BATCH
+// Decodes a burst of up to batchSize packets read from the FIFO on the watermark interrupt
+static bool icm426xxGyroReadFifoBatch(gyroDev_t *gyro)
+{
+    gyroFifo_t *fifo = &gyro->fifo;
+
+    if (gyro->gyroModeSPI == GYRO_EXTI_INIT) {
+        // Let the register read decide on EXTI and DMA, then retarget the DMA transfer at the FIFO
+        mpuGyroReadSPI(gyro);
+        if (gyro->gyroModeSPI == GYRO_EXTI_INT_DMA) {
+            gyroFifoStartDma(gyro);
+        }
+        return false;
+    }
+
+    const uint8_t *rxBuf = gyroFifoRead(gyro);
+    if (!rxBuf) {
+        return false;
+    }
+
+    const int fifoCount = (uint16_t)((rxBuf[1] << 8) | rxBuf[2]);
+    const int frameCount = MIN(fifoCount / ICM426XX_FIFO_FRAME_SIZE, fifo->batchSize);
+    int sampleCount = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        const uint8_t *frame = &rxBuf[ICM426XX_FIFO_HEADER_SIZE + i * ICM426XX_FIFO_FRAME_SIZE];
+
+        if ((frame[0] & ICM426XX_FIFO_HEADER_EMPTY) || !(frame[0] & ICM426XX_FIFO_HEADER_GYRO)) {
+            fifo->droppedFrames++;
+            continue;
+        }
+
+        fifo->samples[sampleCount][X] = (int16_t)((frame[1] << 8) | frame[2]);
+        fifo->samples[sampleCount][Y] = (int16_t)((frame[3] << 8) | frame[4]);
+        fifo->samples[sampleCount][Z] = (int16_t)((frame[5] << 8) | frame[6]);
+        sampleCount++;
+    }
+
+    // A whole batch left behind means the reads have fallen behind the sensor, start again from an empty FIFO
+    const int remaining = fifoCount - frameCount * ICM426XX_FIFO_FRAME_SIZE;
+    if (remaining >= fifo->batchSize * ICM426XX_FIFO_FRAME_SIZE) {
+        spiWriteReg(&gyro->dev, ICM426XX_RA_SIGNAL_PATH_RESET, ICM426XX_FIFO_FLUSH);
+        fifo->droppedFrames += remaining / ICM426XX_FIFO_FRAME_SIZE;
+    }
+
+    gyroFifoCompleteBatch(fifo, sampleCount);
+
+    if (sampleCount == 0) {
+        return false;
+    }
+
+    gyro->gyroADCRaw[X] = fifo->samples[sampleCount - 1][X];
+    gyro->gyroADCRaw[Y] = fifo->samples[sampleCount - 1][Y];
+    gyro->gyroADCRaw[Z] = fifo->samples[sampleCount - 1][Z];
+
+    return true;
+}
+#endif
+
+static bool icm426xxGyroReadSPI(gyroDev_t *gyro)
+{
+#ifdef USE_GYRO_FIFO_BATCH
+    if (gyroFifoIsBatching(&gyro->fifo)) {
+        return icm426xxGyroReadFifoBatch(gyro);
+    }
+#endif
+    return mpuGyroReadSPI(gyro);
+}
+
 bool icm426xxSpiGyroDetect(gyroDev_t *gyro)
 {
     switch (gyro->mpuDetectionResult.sensor) {
@@ -226,7 +331,7 @@ bool icm426xxSpiGyroDetect(gyroDev_t *gyro)
     }
 
     gyro->initFn = icm426xxGyroInit;
-    gyro->readFn = mpuGyroReadSPI;
+    gyro->readFn = icm426xxGyroReadSPI;
 
     gyro->scale = GYRO_SCALE_2000DPS;
 
@@ -0,0 +1,126 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_GYRO_FIFO_BATCH
+
+#include "common/maths.h"
+
+#include "drivers/accgyro/accgyro.h"
+#include "drivers/accgyro/gyro_fifo.h"
+#include "drivers/bus_spi.h"
+#include "drivers/system.h"
+
+void gyroFifoInit(gyroFifo_t *fifo, uint8_t *buffers, uint8_t batchSize)
+{
+    memset(fifo, 0, sizeof(gyroFifo_t));
+    fifo->txBuf = buffers;
+    fifo->rxBuf[0] = &buffers[GYRO_FIFO_BUF_SIZE];
+    fifo->rxBuf[1] = &buffers[2 * GYRO_FIFO_BUF_SIZE];
+    fifo->batchSize = constrain(batchSize, 1, GYRO_FIFO_BATCH_MAX);
+}
+
+// Called by the sensor driver once the FIFO watermark is set to the batch size
+void gyroFifoConfigure(gyroFifo_t *fifo, uint8_t readCommand, uint8_t headerSize, uint8_t frameSize, uint16_t sampleRateHz)
+{
+    fifo->frameSize = frameSize;
+    fifo->headerSize = headerSize;
+    fifo->burstLength = headerSize + fifo->batchSize * frameSize;
+    fifo->samplePeriodCycles = clockMicrosToCycles(1000000) / sampleRateHz;
+
+    memset(fifo->txBuf, 0x00, GYRO_FIFO_BUF_SIZE);
+    fifo->txBuf[0] = readCommand;
+}
+
+// Replaces the register read set up for the EXTI triggered transfer with a FIFO burst
+void gyroFifoStartDma(gyroDev_t *gyro)
+{
+#ifdef USE_GYRO_EXTI
+    gyroFifo_t *fifo = &gyro->fifo;
+
+    fifo->dmaIdx = 0;
+    fifo->readyIdx = 1;
+
+    gyro->dev.callbackArg = (uint32_t)gyro;
+    gyro->segments[0].len = fifo->burstLength;
+    gyro->segments[0].callback = gyroFifoIntcallback;
+    gyro->segments[0].u.buffers.txData = fifo->txBuf;
+    gyro->segments[0].u.buffers.rxData = fifo->rxBuf[fifo->dmaIdx];
+    gyro->segments[0].negateCS = true;
+#else
+    UNUSED(gyro);
+#endif
+}
+
+#ifdef USE_GYRO_EXTI
+// Called in ISR context
+// FIFO burst has just completed, hand the buffer to the gyro task and point the next burst at the other one
+busStatus_e gyroFifoIntcallback(uint32_t arg)
+{
+    gyroDev_t *gyro = (gyroDev_t *)arg;
+    gyroFifo_t *fifo = &gyro->fifo;
+    int32_t gyroDmaDuration = cmpTimeCycles(getCycleCounter(), gyro->gyroLastEXTI);
+
+    if (gyroDmaDuration > gyro->gyroDmaMaxDuration) {
+        gyro->gyroDmaMaxDuration = gyroDmaDuration;
+    }
+
+    fifo->burstCycles[fifo->dmaIdx] = gyro->gyroLastEXTI;
+    fifo->readyIdx = fifo->dmaIdx;
+    fifo->dmaIdx ^= 1;
+    gyro->segments[0].u.buffers.rxData = fifo->rxBuf[fifo->dmaIdx];
+
+    gyro->dataReady = true;
+
+    return BUS_READY;
+}
+#endif
+
+// Returns the buffer holding the latest burst, or NULL if the DMA has not completed a new one.
+// Without EXTI triggered DMA the burst is read here instead.
+const uint8_t *gyroFifoRead(gyroDev_t *gyro)
+{
+    gyroFifo_t *fifo = &gyro->fifo;
+
+    if (gyro->gyroModeSPI == GYRO_EXTI_INT_DMA) {
+        if (!gyro->dataReady) {
+            return NULL;
+        }
+    } else {
+        spiReadWriteBuf(&gyro->dev, fifo->txBuf, fifo->rxBuf[0], fifo->burstLength);
+        fifo->burstCycles[0] = getCycleCounter();
+        fifo->readyIdx = 0;
+    }
+
+    return fifo->rxBuf[fifo->readyIdx];
+}
+
+void gyroFifoCompleteBatch(gyroFifo_t *fifo, uint8_t sampleCount)
+{
+    fifo->sampleCount = sampleCount;
+    fifo->sampleCycles = fifo->burstCycles[fifo->readyIdx];
+}
+#endif // USE_GYRO_FIFO_BATCH
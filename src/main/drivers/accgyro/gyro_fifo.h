@@ -0,0 +1,72 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/axis.h"
+
+#include "drivers/bus.h"
+
+#define GYRO_FIFO_BATCH_MAX 8
+#define GYRO_FIFO_HEADER_MAX 4      // register address, dummy byte and 16 bit FIFO length
+#define GYRO_FIFO_FRAME_MAX 8       // largest gyro only FIFO record of the supported sensors
+#define GYRO_FIFO_BUF_SIZE (GYRO_FIFO_HEADER_MAX + GYRO_FIFO_BATCH_MAX * GYRO_FIFO_FRAME_MAX)
+#define GYRO_FIFO_BUF_COUNT 3       // transmit buffer plus the two receive buffers
+
+struct gyroDev_s;
+
+typedef struct gyroFifo_s {
+    uint8_t *txBuf;                             // FIFO read command, sent with every burst
+    uint8_t *rxBuf[2];                          // double buffer, one is filled by DMA while the other is decoded
+    uint32_t burstCycles[2];                    // EXTI time of the burst that filled each buffer
+    volatile uint8_t dmaIdx;                    // buffer the next burst is read into
+    volatile uint8_t readyIdx;                  // last completed buffer
+    uint8_t batchSize;                          // samples per burst
+    uint8_t frameSize;                          // bytes per FIFO record, 0 until the driver configures the FIFO
+    uint8_t headerSize;                         // bytes preceding the first record
+    uint8_t burstLength;
+    uint32_t samplePeriodCycles;                // sensor ODR period, used to reconstruct the sample times
+    uint32_t sampleCycles;                      // reconstructed time of the newest decoded sample
+    uint8_t sampleCount;                        // samples decoded from the last burst
+    uint16_t droppedFrames;                     // invalid or flushed records
+    int16_t samples[GYRO_FIFO_BATCH_MAX][XYZ_AXIS_COUNT];
+} gyroFifo_t;
+
+void gyroFifoInit(gyroFifo_t *fifo, uint8_t *buffers, uint8_t batchSize);
+void gyroFifoConfigure(gyroFifo_t *fifo, uint8_t readCommand, uint8_t headerSize, uint8_t frameSize, uint16_t sampleRateHz);
+void gyroFifoStartDma(struct gyroDev_s *gyro);
+busStatus_e gyroFifoIntcallback(uint32_t arg);
+const uint8_t *gyroFifoRead(struct gyroDev_s *gyro);
+void gyroFifoCompleteBatch(gyroFifo_t *fifo, uint8_t sampleCount);
+
+static inline bool gyroFifoIsBatching(const gyroFifo_t *fifo)
+{
+    return fifo->frameSize && fifo->batchSize > 1;
+}
+
+// Samples in a burst are spaced by the sensor ODR and the newest one is the sample that raised the watermark interrupt
+static inline uint32_t gyroFifoSampleCycles(const gyroFifo_t *fifo, int index)
+{
+    return fifo->sampleCycles - (fifo->sampleCount - 1 - index) * fifo->samplePeriodCycles;
+}
@@ -379,6 +379,14 @@ static void flashConfigurePartitions(void)
 #endif
 
 #ifdef USE_FLASHFS
+#ifdef USE_FLASHFS_INDEX
+    // Searching the volume for logs is only slow enough on large NAND parts to be worth a sector for the log index
+    if (flashGeometry->flashType == FLASH_TYPE_NAND && endSector > startSector) {
+        flashPartitionSet(FLASH_PARTITION_TYPE_FLASHFS_INDEX, endSector, endSector);
+        endSector--;
+    }
+#endif
+
     flashPartitionSet(FLASH_PARTITION_TYPE_FLASHFS, startSector, endSector);
 #endif
 }
@@ -428,6 +436,7 @@ static const char *flashPartitionNames[] = {
     "BBMGMT   ",
     "FIRMWARE ",
     "CONFIG   ",
+    "FSINDEX  ",
 };
 
 const char *flashPartitionGetTypeName(flashPartitionType_e type)
@@ -37,6 +37,7 @@
 #include "drivers/time.h"
 #include "drivers/dshot_bitbang.h"
 #include "drivers/dshot_dpwm.h"
+#include "drivers/motor_latency.h"
 
 #include "fc/rc_controls.h" // for flight3DConfig_t
 
@@ -56,18 +57,48 @@ void motorShutdown(void)
     delayMicroseconds(1500);
 }
 
+#if defined(USE_PWM_OUTPUT) && defined(USE_DSHOT) && defined(USE_DSHOT_TELEMETRY)
+// Longest busy wait for the DShot telemetry deadtime before the update is left for the next loop
+#define MOTOR_IMMEDIATE_UPDATE_TIMEOUT_US 50
+
+static bool motorUpdateStart(void)
+{
+    if (motorDevice->vTable.updateStart()) {
+        return true;
+    }
+
+    // updateStart() refuses before touching the outputs, so it can be retried until the deadtime has passed
+    if (motorDevice->immediateUpdate) {
+        const timeUs_t startUs = micros();
+        do {
+            if (motorDevice->vTable.updateStart()) {
+                return true;
+            }
+        } while (cmpTimeUs(micros(), startUs) < MOTOR_IMMEDIATE_UPDATE_TIMEOUT_US);
+    }
+
+#ifdef USE_MOTOR_LATENCY_STATS
+    motorLatencyMarkSkipped();
+#endif
+    return false;
+}
+#endif
+
 void motorWriteAll(float *values)
 {
 #ifdef USE_PWM_OUTPUT
     if (motorDevice->enabled) {
 #if defined(USE_DSHOT) && defined(USE_DSHOT_TELEMETRY)
-        if (!motorDevice->vTable.updateStart()) {
+        if (!motorUpdateStart()) {
             return;
         }
 #endif
         for (int i = 0; i < motorDevice->count; i++) {
             motorDevice->vTable.write(i, values[i]);
         }
+#ifdef USE_MOTOR_LATENCY_STATS
+        motorLatencyMarkOutput();
+#endif
         motorDevice->vTable.updateComplete();
     }
 #endif
@@ -287,6 +318,7 @@ void motorDevInit(const motorDevConfig_t *motorDevConfig, uint16_t idlePulse, ui
         motorDevice->initialized = true;
         motorDevice->motorEnableTimeMs = 0;
         motorDevice->enabled = false;
+        motorDevice->immediateUpdate = motorDevConfig->useDshotImmediateUpdate;
     } else {
         motorNullDevice.vTable = motorNullVTable;
         motorDevice = &motorNullDevice;
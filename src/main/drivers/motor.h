@@ -66,6 +66,7 @@ typedef struct motorDevice_s {
     bool          initialized;
     bool          enabled;
     timeMs_t      motorEnableTimeMs;
+    bool          immediateUpdate;
 } motorDevice_t;
 
 void motorPostInitNull();
@@ -0,0 +1,112 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Gyro to motor output latency.
+ *
+ * The cycle counter is read when a gyro sample is taken and again just before the motor update starts the
+ * DShot DMA. Recording only runs with debug_mode = MOTOR_LATENCY, which also logs the latest, minimum,
+ * maximum and average latency to blackbox.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_MOTOR_LATENCY_STATS
+
+#include "build/debug.h"
+
+#include "common/maths.h"
+#include "common/time.h"
+
+#include "drivers/system.h"
+
+#include "motor_latency.h"
+
+static FAST_DATA_ZERO_INIT uint32_t gyroSampleCycles;
+static FAST_DATA_ZERO_INIT bool gyroSampleFresh;     // a sample has been taken since the last motor output
+static FAST_DATA_ZERO_INIT motorLatencyStats_t stats;
+
+bool motorLatencyIsEnabled(void)
+{
+    return debugMode == DEBUG_MOTOR_LATENCY;
+}
+
+FAST_CODE void motorLatencyMarkGyroSample(void)
+{
+    if (motorLatencyIsEnabled()) {
+        gyroSampleCycles = getCycleCounter();
+        gyroSampleFresh = true;
+    }
+}
+
+FAST_CODE void motorLatencyMarkOutput(void)
+{
+    if (!motorLatencyIsEnabled() || !gyroSampleFresh) {
+        return;
+    }
+    gyroSampleFresh = false;
+
+    const int32_t latencyUs10 = MAX(clockCyclesTo10thMicros(cmpTimeCycles(getCycleCounter(), gyroSampleCycles)), 0);
+
+    if (stats.sampleCount == 0 || (uint32_t)latencyUs10 < stats.minUs10) {
+        stats.minUs10 = latencyUs10;
+    }
+    if ((uint32_t)latencyUs10 > stats.maxUs10) {
+        stats.maxUs10 = latencyUs10;
+    }
+    stats.lastUs10 = latencyUs10;
+    stats.totalUs10 += latencyUs10;
+    stats.sampleCount++;
+    stats.histogram[MIN(latencyUs10 / (MOTOR_LATENCY_BUCKET_WIDTH_US * 10), MOTOR_LATENCY_BUCKET_COUNT - 1)]++;
+
+    DEBUG_SET(DEBUG_MOTOR_LATENCY, 0, latencyUs10);
+    DEBUG_SET(DEBUG_MOTOR_LATENCY, 1, stats.minUs10);
+    DEBUG_SET(DEBUG_MOTOR_LATENCY, 2, stats.maxUs10);
+    DEBUG_SET(DEBUG_MOTOR_LATENCY, 3, motorLatencyAverageUs10());
+}
+
+void motorLatencyMarkSkipped(void)
+{
+    if (motorLatencyIsEnabled()) {
+        stats.skippedUpdates++;
+    }
+}
+
+void motorLatencyReset(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    gyroSampleFresh = false;
+}
+
+const motorLatencyStats_t *motorLatencyGetStats(void)
+{
+    return &stats;
+}
+
+uint32_t motorLatencyAverageUs10(void)
+{
+    return stats.sampleCount ? stats.totalUs10 / stats.sampleCount : 0;
+}
+
+#endif // USE_MOTOR_LATENCY_STATS
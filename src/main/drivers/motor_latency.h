@@ -0,0 +1,45 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MOTOR_LATENCY_BUCKET_COUNT      16
+#define MOTOR_LATENCY_BUCKET_WIDTH_US   10  // the last bucket collects everything above the others
+
+typedef struct motorLatencyStats_s {
+    uint32_t sampleCount;
+    uint32_t skippedUpdates;        // motor updates not sent because DShot telemetry was still being received
+    uint32_t minUs10;               // gyro sample to motor DMA start, in tenths of a microsecond
+    uint32_t maxUs10;
+    uint32_t lastUs10;
+    uint64_t totalUs10;
+    uint32_t histogram[MOTOR_LATENCY_BUCKET_COUNT];
+} motorLatencyStats_t;
+
+void motorLatencyMarkGyroSample(void);
+void motorLatencyMarkOutput(void);
+void motorLatencyMarkSkipped(void);
+void motorLatencyReset(void);
+bool motorLatencyIsEnabled(void);
+const motorLatencyStats_t *motorLatencyGetStats(void);
+uint32_t motorLatencyAverageUs10(void);
@@ -151,6 +151,22 @@ sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer,
     return sdcardVTable->sdcard_writeBlock(blockIndex, buffer, callback, callbackData);
 }
 
+/**
+ * Write a run of consecutive blocks, where buffers[i] holds the block blockIndex + i. On entry blockCount is the number
+ * of blocks in the run, on return the number of blocks the driver accepted, which may be fewer. The callback is called
+ * for each accepted block just like for sdcard_writeBlock(), and the buffers array must stay valid until then.
+ */
+sdcardOperationStatus_e sdcard_writeBlocks(uint32_t blockIndex, uint8_t *const *buffers, uint32_t *blockCount, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (sdcardVTable->sdcard_writeBlocks) {
+        return sdcardVTable->sdcard_writeBlocks(blockIndex, buffers, blockCount, callback, callbackData);
+    }
+
+    *blockCount = 1;
+
+    return sdcardVTable->sdcard_writeBlock(blockIndex, buffers[0], callback, callbackData);
+}
+
 bool sdcard_poll(void)
 {
     // sdcard_poll is called from taskMain() via afatfs_poll() and  for USE_SDCARD.
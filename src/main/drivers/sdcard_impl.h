@@ -77,6 +77,10 @@ typedef struct sdcard_t {
     uint32_t multiWriteNextBlock;
     uint32_t multiWriteBlocksRemain;
 
+    // Further blocks queued by sdcard_writeBlocks(), sent as soon as the card has accepted the previous one
+    uint8_t *const *streamBuffers;
+    uint32_t streamBlocksRemain;
+
     sdcardState_e state;
 
     sdcardMetadata_t metadata;
@@ -114,6 +118,7 @@ typedef struct sdcardVTable_s {
     bool (*sdcard_readBlock)(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
     sdcardOperationStatus_e (*sdcard_beginWriteBlocks)(uint32_t blockIndex, uint32_t blockCount);
     sdcardOperationStatus_e (*sdcard_writeBlock)(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+    sdcardOperationStatus_e (*sdcard_writeBlocks)(uint32_t blockIndex, uint8_t *const *buffers, uint32_t *blockCount, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
     bool (*sdcard_poll)(void);
     bool (*sdcard_isFunctional)(void);
     bool (*sdcard_isInitialized)(void);
@@ -655,6 +655,7 @@ sdcardVTable_t sdcardSdioVTable = {
     sdcardSdio_readBlock,
     sdcardSdio_beginWriteBlocks,
     sdcardSdio_writeBlock,
+    NULL,
     sdcardSdio_poll,
     sdcardSdio_isFunctional,
     sdcardSdio_isInitialized,
@@ -25,6 +25,8 @@
 
 #ifdef USE_SDCARD_SPI
 
+#include "common/maths.h"
+
 #include "drivers/bus_spi.h"
 #include "drivers/dma.h"
 #include "drivers/dma_reqmap.h"
@@ -93,8 +95,22 @@ static void sdcard_deselect(void)
  * Increments the failure counter, and when the failure threshold is reached, disables the card until
  * the next call to sdcard_init().
  */
+static void sdcard_abortStream(void)
+{
+    // The queued blocks will never be sent, so hand them back to the caller as failed writes
+    for (uint32_t i = 1; i <= sdcard.streamBlocksRemain; i++) {
+        if (sdcard.pendingOperation.callback) {
+            sdcard.pendingOperation.callback(SDCARD_BLOCK_OPERATION_WRITE, sdcard.pendingOperation.blockIndex + i, NULL, sdcard.pendingOperation.callbackData);
+        }
+    }
+
+    sdcard.streamBlocksRemain = 0;
+}
+
 static void sdcard_reset(void)
 {
+    sdcard_abortStream();
+
     if (!sdcard_isInserted()) {
         sdcard.state = SDCARD_STATE_NOT_PRESENT;
         return;
@@ -806,6 +822,23 @@ static bool sdcardSpi_poll(void)
                     sdcard.profiler(SDCARD_BLOCK_OPERATION_WRITE, sdcard.pendingOperation.blockIndex, micros() - sdcard.pendingOperation.profileStartTime);
                 }
 #endif
+
+                if (sdcard.streamBlocksRemain > 0 && sdcard.state == SDCARD_STATE_WRITING_MULTIPLE_BLOCKS) {
+                    // Send the next queued block now rather than waiting for the caller to come back with it
+                    sdcard.streamBlocksRemain--;
+
+#ifdef SDCARD_PROFILING
+                    sdcard.pendingOperation.profileStartTime = micros();
+#endif
+                    sdcard.pendingOperation.buffer = *sdcard.streamBuffers++;
+                    sdcard.pendingOperation.blockIndex = sdcard.multiWriteNextBlock;
+                    sdcard.pendingOperation.chunkIndex = 1;
+                    sdcard.state = SDCARD_STATE_SENDING_WRITE;
+
+                    sdcard_sendDataBlockBegin(sdcard.pendingOperation.buffer, true);
+
+                    goto doMore;
+                }
             } else if (millis() > sdcard.operationStartTime + SDCARD_TIMEOUT_WRITE_MSEC) {
                 /*
                  * The caller has already been told that their write has completed, so they will have discarded
@@ -962,6 +995,35 @@ static sdcardOperationStatus_e sdcardSpi_writeBlock(uint32_t blockIndex, uint8_t
     return SDCARD_OPERATION_IN_PROGRESS;
 }
 
+/**
+ * Write a run of consecutive blocks. Within a multi-block write the whole run (up to the end of the multi-block write)
+ * is accepted and each following block is sent from sdcard_poll() as soon as the card has finished with the one before,
+ * otherwise only the first block is written.
+ *
+ * SPI mode cards answer every block with a data response and then hold the bus busy while they program it, so the
+ * blocks can't be chained into a single DMA transfer.
+ */
+static sdcardOperationStatus_e sdcardSpi_writeBlocks(uint32_t blockIndex, uint8_t *const *buffers, uint32_t *blockCount, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    uint32_t accepted = 1;
+
+    if (sdcard.state == SDCARD_STATE_WRITING_MULTIPLE_BLOCKS && blockIndex == sdcard.multiWriteNextBlock) {
+        accepted = MAX(MIN(*blockCount, sdcard.multiWriteBlocksRemain), 1U);
+    }
+
+    const sdcardOperationStatus_e status = sdcardSpi_writeBlock(blockIndex, buffers[0], callback, callbackData);
+
+    if (status == SDCARD_OPERATION_IN_PROGRESS) {
+        sdcard.streamBuffers = buffers + 1;
+        sdcard.streamBlocksRemain = accepted - 1;
+        *blockCount = accepted;
+    } else {
+        *blockCount = 0;
+    }
+
+    return status;
+}
+
 /**
  * Begin writing a series of consecutive blocks beginning at the given block index. This will allow (but not require)
  * the SD card to pre-erase the number of blocks you specifiy, which can allow the writes to complete faster.
@@ -1092,6 +1154,7 @@ sdcardVTable_t sdcardSpiVTable = {
     sdcardSpi_readBlock,
     sdcardSpi_beginWriteBlocks,
     sdcardSpi_writeBlock,
+    sdcardSpi_writeBlocks,
     sdcardSpi_poll,
     sdcardSpi_isFunctional,
     sdcardSpi_isInitialized,
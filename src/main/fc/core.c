@@ -46,6 +46,7 @@
 #include "drivers/dshot_command.h"
 #include "drivers/light_led.h"
 #include "drivers/motor.h"
+#include "drivers/motor_latency.h"
 #include "drivers/sound_beeper.h"
 #include "drivers/system.h"
 #include "drivers/time.h"
@@ -1083,13 +1084,12 @@ void processRxModes(timeUs_t currentTimeUs)
     pidSetAntiGravityState(IS_RC_MODE_ACTIVE(BOXANTIGRAVITY) || featureIsEnabled(FEATURE_ANTI_GRAVITY));
 }
 
-static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
+// Checks on the PID output that do not feed the motors this loop, run after the motor update in the fused loop
+static FAST_CODE void subTaskPidChecks(timeUs_t currentTimeUs)
 {
-    uint32_t startTime = 0;
-    if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
-    // PID - note this is function pointer set by setPIDController()
-    pidController(currentPidProfile, currentTimeUs);
-    DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
+#ifndef USE_RUNAWAY_TAKEOFF
+    UNUSED(currentTimeUs);
+#endif
 
 #ifdef USE_RUNAWAY_TAKEOFF
     // Check to see if runaway takeoff detection is active (anti-taz), the pidSum is over the threshold,
@@ -1137,6 +1137,17 @@ static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
 #endif
 }
 
+static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
+{
+    uint32_t startTime = 0;
+    if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    // PID - note this is function pointer set by setPIDController()
+    pidController(currentPidProfile, currentTimeUs);
+    DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
+
+    subTaskPidChecks(currentTimeUs);
+}
+
 static FAST_CODE_NOINLINE void subTaskPidSubprocesses(timeUs_t currentTimeUs)
 {
     uint32_t startTime = 0;
@@ -1191,6 +1202,9 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
 
     mixTable(currentTimeUs);
 
+    // motors are written first as they are the latency critical output
+    writeMotors();
+
 #ifdef USE_SERVOS
     // motor outputs are used as sources for servo mixing, so motors must be calculated using mixTable() before servos.
     if (isMixerUsingServos()) {
@@ -1198,8 +1212,6 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
     }
 #endif
 
-    writeMotors();
-
 #ifdef USE_DSHOT_TELEMETRY_STATS
     if (debugMode == DEBUG_DSHOT_RPM_ERRORS && useDshotTelemetry) {
         const uint8_t motorCount = MIN(getMotorCount(), 4);
@@ -1238,6 +1250,9 @@ static FAST_CODE_NOINLINE void subTaskRcCommand(timeUs_t currentTimeUs)
 FAST_CODE void taskGyroSample(timeUs_t currentTimeUs)
 {
     UNUSED(currentTimeUs);
+#ifdef USE_MOTOR_LATENCY_STATS
+    motorLatencyMarkGyroSample();
+#endif
     gyroUpdate();
     if (pidUpdateCounter % activePidLoopDenom == 0) {
         pidUpdateCounter = 0;
@@ -1247,6 +1262,10 @@ FAST_CODE void taskGyroSample(timeUs_t currentTimeUs)
 
 FAST_CODE bool gyroFilterReady(void)
 {
+    if (pidConfig()->fused_pid_loop) {
+        // filtering runs from taskMainPidLoop()
+        return false;
+    }
     if (pidUpdateCounter % activePidLoopDenom == 0) {
         return true;
     } else {
@@ -1256,7 +1275,9 @@ FAST_CODE bool gyroFilterReady(void)
 
 FAST_CODE bool pidLoopReady(void)
 {
-    if ((pidUpdateCounter % activePidLoopDenom) == (activePidLoopDenom / 2)) {
+    // The fused loop filters the gyro itself, so it runs on the slot filtering would have used
+    const uint8_t pidSlot = pidConfig()->fused_pid_loop ? 0 : activePidLoopDenom / 2;
+    if ((pidUpdateCounter % activePidLoopDenom) == pidSlot) {
         return true;
     }
     return false;
@@ -1283,9 +1304,24 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
     // 3 - subTaskPidSubprocesses()
     DEBUG_SET(DEBUG_PIDLOOP, 0, micros() - currentTimeUs);
 
-    subTaskRcCommand(currentTimeUs);
-    subTaskPidController(currentTimeUs);
-    subTaskMotorUpdate(currentTimeUs);
+    if (pidConfig()->fused_pid_loop) {
+        // Filtering, PID, mixing and the motor write back to back from the freshest gyro sample,
+        // everything that does not affect this loop's motor output is deferred until after it
+        gyroFiltering(currentTimeUs);
+        subTaskRcCommand(currentTimeUs);
+
+        uint32_t startTime = 0;
+        if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+        pidController(currentPidProfile, currentTimeUs);
+        DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
+
+        subTaskMotorUpdate(currentTimeUs);
+        subTaskPidChecks(currentTimeUs);
+    } else {
+        subTaskRcCommand(currentTimeUs);
+        subTaskPidController(currentTimeUs);
+        subTaskMotorUpdate(currentTimeUs);
+    }
     subTaskPidSubprocesses(currentTimeUs);
 
     DEBUG_SET(DEBUG_CYCLETIME, 0, getTaskDeltaTimeUs(TASK_SELF));
@@ -26,10 +26,14 @@
 #define PARAM_NAME_GYRO_LPF2_TYPE "gyro_lpf2_type"
 #define PARAM_NAME_GYRO_LPF2_STATIC_HZ "gyro_lpf2_static_hz"
 #define PARAM_NAME_GYRO_TO_USE "gyro_to_use"
+#define PARAM_NAME_GYRO_FUSION_OUTLIER_DPS "gyro_fusion_outlier_dps"
+#define PARAM_NAME_GYRO_FIFO_BATCH "gyro_fifo_batch"
 #define PARAM_NAME_DYN_NOTCH_MAX_HZ "dyn_notch_max_hz"
 #define PARAM_NAME_DYN_NOTCH_COUNT "dyn_notch_count"
 #define PARAM_NAME_DYN_NOTCH_Q "dyn_notch_q"
 #define PARAM_NAME_DYN_NOTCH_MIN_HZ "dyn_notch_min_hz"
+#define PARAM_NAME_DYN_NOTCH_ENGINE "dyn_notch_engine"
+#define PARAM_NAME_DYN_NOTCH_SDFT_SIZE "dyn_notch_sdft_size"
 #define PARAM_NAME_ACC_HARDWARE "acc_hardware"
 #define PARAM_NAME_ACC_LPF_HZ "acc_lpf_hz"
 #define PARAM_NAME_MAG_HARDWARE "mag_hardware"
@@ -61,6 +61,7 @@
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
 #include "io/dashboard.h"
+#include "io/flashfs.h"
 #include "io/gps.h"
 #include "io/ledstrip.h"
 #include "io/piniobox.h"
@@ -78,6 +79,7 @@
 
 #include "pg/rx.h"
 #include "pg/motor.h"
+#include "pg/flash.h"
 
 #include "rx/rx.h"
 
@@ -431,6 +433,10 @@ task_attribute_t task_attributes[TASK_COUNT] = {
 #ifdef USE_CRSF_V3
     [TASK_SPEED_NEGOTIATION] = DEFINE_TASK("SPEED_NEGOTIATION", NULL, NULL, speedNegotiationProcess, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW),
 #endif
+
+#ifdef USE_FLASHFS
+    [TASK_FLASHFS] = DEFINE_TASK("FLASHFS", NULL, NULL, flashfsEraseAheadUpdate, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOWEST),
+#endif
 };
 
 task_t *getTask(unsigned taskId)
@@ -479,7 +485,8 @@ void tasksInit(void)
         rescheduleTask(TASK_FILTER, gyro.targetLooptime);
         rescheduleTask(TASK_PID, gyro.targetLooptime);
         setTaskEnabled(TASK_GYRO, true);
-        setTaskEnabled(TASK_FILTER, true);
+        // the fused loop runs gyro filtering from the PID task
+        setTaskEnabled(TASK_FILTER, !pidConfig()->fused_pid_loop);
         setTaskEnabled(TASK_PID, true);
         schedulerEnableGyro();
     }
@@ -594,5 +601,9 @@ void tasksInit(void)
     const bool useCRSF = rxRuntimeState.serialrxProvider == SERIALRX_CRSF;
     setTaskEnabled(TASK_SPEED_NEGOTIATION, useCRSF);
 #endif
+
+#ifdef USE_FLASHFS
+    setTaskEnabled(TASK_FLASHFS, flashfsIsSupported() && flashConfig()->eraseAhead);
+#endif
 }
 
@@ -44,6 +44,7 @@
 
 #include "config/feature.h"
 
+#include "drivers/system.h"
 #include "drivers/time.h"
 
 #include "fc/core.h"
@@ -52,10 +53,11 @@
 
 #include "dyn_notch_filter.h"
 
-// SDFT_SAMPLE_SIZE defaults to 72 (common/sdft.h).
-// We get 36 frequency bins from 72 consecutive data values, called SDFT_BIN_COUNT (common/sdft.h)
+// The SDFT sample size is set by dyn_notch_sdft_size (48, 72, 96 or 128), the examples below use the default of 72.
+// We get 36 frequency bins from 72 consecutive data values, see sdftBinCount() (common/sdft.h)
 // Bin 0 is DC and can't be used.
 // Only bins 1 to 35 are usable.
+// A smaller size gives coarser bins and a cheaper SDFT, a larger size gives finer bins but takes longer to fill.
 
 // A gyro sample is collected every PID loop.
 // sampleCount recent gyro values are accumulated and averaged
@@ -80,7 +82,12 @@
 // Four points in the buffer will have changed in that time, and each point will be the average of three samples.
 // Hence output jitter at 4k is about four times worse than at 8k. At 2k output jitter is quite bad.
 
-// Each SDFT output bin has width sdftSampleRateHz/72, ie 18.5Hz per bin at 1333Hz.
+// The ALL_AXES engine keeps the three SDFTs in one interleaved sdftAxes_t and runs every step for all axes at once.
+// A full peak search and notch update of all axes is completed within one SDFT sample period (sampleCount PID loops),
+// running several steps per loop if sampleCount is smaller than the number of steps.
+// At 8k with 600Hz max every axis is updated every 0.75ms instead of every 1.5ms.
+
+// Each SDFT output bin has width sdftSampleRateHz/72 with 72 samples, ie 18.5Hz per bin at 1333Hz.
 // Usable bandwidth is half this, ie 666Hz if sdftSampleRateHz is 1333Hz, i.e. bin 1 is 18.5Hz, bin 2 is 37.0Hz etc.
 
 #define DYN_NOTCH_SMOOTH_HZ        4
@@ -111,6 +118,7 @@ typedef struct state_s {
     int tick;
     int step;
     int axis;
+    int stepsPerTick;
 
 } state_t;
 
@@ -120,11 +128,13 @@ typedef struct dynNotch_s {
     float minHz;
     float maxHz;
     int count;
+    uint8_t engine;
 
     int maxCenterFreq;
     float centerFreq[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
     
     timeUs_t looptimeUs;
+    float looptimeS;
     biquadFilter_t notch[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
 
 } dynNotch_t;
@@ -141,17 +151,28 @@ static FAST_DATA_ZERO_INIT float sampleAccumulator[XYZ_AXIS_COUNT];
 // downsampled data for frequency analysis
 static FAST_DATA_ZERO_INIT float sampleAvg[XYZ_AXIS_COUNT];
 
+// only the SDFT layout of the active engine is needed
+typedef union sdftEngine_u {
+
+    sdft_t stepped[XYZ_AXIS_COUNT];
+    struct {
+        sdftAxes_t sdft;
+        biquadNotchTable_t notchTable;
+    } allAxes;
+
+} sdftEngine_t;
+
 // parameters for peak detection and frequency analysis
-static FAST_DATA_ZERO_INIT state_t state;
-static FAST_DATA_ZERO_INIT sdft_t  sdft[XYZ_AXIS_COUNT];
-static FAST_DATA_ZERO_INIT peak_t  peaks[DYN_NOTCH_COUNT_MAX];
-static FAST_DATA_ZERO_INIT float   sdftData[SDFT_BIN_COUNT];
-static FAST_DATA_ZERO_INIT float   sdftSampleRateHz;
-static FAST_DATA_ZERO_INIT float   sdftResolutionHz;
-static FAST_DATA_ZERO_INIT int     sdftStartBin;
-static FAST_DATA_ZERO_INIT int     sdftEndBin;
-static FAST_DATA_ZERO_INIT float   sdftNoiseThreshold;
-static FAST_DATA_ZERO_INIT float   pt1LooptimeS;
+static FAST_DATA_ZERO_INIT state_t      state;
+static FAST_DATA_ZERO_INIT sdftEngine_t sdft;
+static FAST_DATA_ZERO_INIT peak_t       peaks[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
+static FAST_DATA_ZERO_INIT float        sdftData[XYZ_AXIS_COUNT][SDFT_BIN_COUNT_MAX];
+static FAST_DATA_ZERO_INIT float        sdftSampleRateHz;
+static FAST_DATA_ZERO_INIT float        sdftResolutionHz;
+static FAST_DATA_ZERO_INIT int          sdftStartBin;
+static FAST_DATA_ZERO_INIT int          sdftEndBin;
+static FAST_DATA_ZERO_INIT float        sdftNoiseThreshold[XYZ_AXIS_COUNT];
+static FAST_DATA_ZERO_INIT float        pt1LooptimeS;
 
 
 void dynNotchInit(const dynNotchConfig_t *config, const timeUs_t targetLooptimeUs)
@@ -161,9 +182,13 @@ void dynNotchInit(const dynNotchConfig_t *config, const timeUs_t targetLooptimeU
     dynNotch.minHz = config->dyn_notch_min_hz;
     dynNotch.maxHz = MAX(2 * dynNotch.minHz, config->dyn_notch_max_hz);
     dynNotch.count = config->dyn_notch_count;
+    dynNotch.engine = config->dyn_notch_engine;
     dynNotch.looptimeUs = targetLooptimeUs;
+    dynNotch.looptimeS = targetLooptimeUs * 1e-6f;
     dynNotch.maxCenterFreq = 0;
 
+    const sdftSize_e sdftSize = config->dyn_notch_sdft_size;
+
     // dynNotchUpdate() is running at looprateHz (which is PID looprate aka. 1e6f / gyro.targetLooptime)
     const float looprateHz = 1.0f / dynNotch.looptimeUs * 1e6f;
 
@@ -183,13 +208,28 @@ void dynNotchInit(const dynNotchConfig_t *config, const timeUs_t targetLooptimeU
     // eg 1k, user max 600hz, int(1000/1200) = 1 (max(1,0.8333)) sdftSampleRateHz = 1000hz, range 500Hz
     // the upper limit of DN is always going to be the Nyquist frequency (= sampleRate / 2)
 
-    sdftResolutionHz = sdftSampleRateHz / SDFT_SAMPLE_SIZE; // 18.5hz per bin at 8k and 600Hz maxHz
+    sdftResolutionHz = sdftSampleRateHz / sdftSampleSize(sdftSize); // 18.5hz per bin at 8k, 600Hz maxHz and 72 samples
     sdftStartBin = MAX(2, dynNotch.minHz / sdftResolutionHz + 0.5f); // can't use bin 0 because it is DC.
-    sdftEndBin = MIN(SDFT_BIN_COUNT - 1, dynNotch.maxHz / sdftResolutionHz + 0.5f); // can't use more than SDFT_BIN_COUNT bins.
-    pt1LooptimeS = DYN_NOTCH_CALC_TICKS / looprateHz;
+    sdftEndBin = MIN(sdftBinCount(sdftSize) - 1, dynNotch.maxHz / sdftResolutionHz + 0.5f); // can't use more than sdftBinCount() bins.
 
-    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        sdftInit(&sdft[axis], sdftStartBin, sdftEndBin, sampleCount);
+    state.tick = 0;
+    state.step = STEP_WINDOW;
+    state.axis = 0;
+
+    if (dynNotch.engine == DYN_NOTCH_ENGINE_ALL_AXES) {
+        // all steps for all axes have to be done before the next downsampled value arrives
+        state.stepsPerTick = (STEP_COUNT + sampleCount - 1) / sampleCount;
+        pt1LooptimeS = sampleCount / looprateHz;
+
+        sdftAxesInit(&sdft.allAxes.sdft, sdftSize, sdftStartBin, sdftEndBin, sampleCount);
+        biquadNotchTableInit(&sdft.allAxes.notchTable, dynNotch.q);
+    } else {
+        state.stepsPerTick = 1;
+        pt1LooptimeS = DYN_NOTCH_CALC_TICKS / looprateHz;
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sdftInit(&sdft.stepped[axis], sdftSize, sdftStartBin, sdftEndBin, sampleCount);
+        }
     }
 
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
@@ -208,6 +248,7 @@ FAST_CODE void dynNotchPush(const int axis, const float sample)
 }
 
 static void dynNotchProcess(void);
+static void dynNotchProcessAllAxes(void);
 
 // Downsample and analyse gyro data
 FAST_CODE void dynNotchUpdate(void)
@@ -226,17 +267,35 @@ FAST_CODE void dynNotchUpdate(void)
             }
         }
 
-        // We need DYN_NOTCH_CALC_TICKS ticks to update all axes with newly sampled value
-        // recalculation of filters takes 4 calls per axis => each filter gets updated every DYN_NOTCH_CALC_TICKS calls
-        // at 8kHz PID loop rate this means 8kHz / 4 / 3 = 666Hz => update every 1.5ms
-        // at 4kHz PID loop rate this means 4kHz / 4 / 3 = 333Hz => update every 3ms
-        state.tick = DYN_NOTCH_CALC_TICKS;
+        if (dynNotch.engine == DYN_NOTCH_ENGINE_ALL_AXES) {
+            // restart the analysis of all axes on the newest spectrum
+            state.step = STEP_WINDOW;
+            state.tick = STEP_COUNT;
+        } else {
+            // We need DYN_NOTCH_CALC_TICKS ticks to update all axes with newly sampled value
+            // recalculation of filters takes 4 calls per axis => each filter gets updated every DYN_NOTCH_CALC_TICKS calls
+            // at 8kHz PID loop rate this means 8kHz / 4 / 3 = 666Hz => update every 1.5ms
+            // at 4kHz PID loop rate this means 4kHz / 4 / 3 = 333Hz => update every 3ms
+            state.tick = DYN_NOTCH_CALC_TICKS;
+        }
+    }
+
+    if (dynNotch.engine == DYN_NOTCH_ENGINE_ALL_AXES) {
+        // all axes share the twiddle factors of one batch
+        sdftAxesPushBatch(&sdft.allAxes.sdft, sampleAvg, sampleIndex);
+        sampleIndex++;
+
+        for (int i = 0; i < state.stepsPerTick && state.tick > 0; i++) {
+            dynNotchProcessAllAxes();
+            --state.tick;
+        }
+        return;
     }
 
     // 2us @ F722
     // SDFT processing in batches to synchronize with incoming downsampled data
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        sdftPushBatch(&sdft[axis], sampleAvg[axis], sampleIndex);
+        sdftPushBatch(&sdft.stepped[axis], sampleAvg[axis], sampleIndex);
     }
     sampleIndex++;
 
@@ -247,12 +306,136 @@ FAST_CODE void dynNotchUpdate(void)
     }
 }
 
+// Get total vibrational power in dyn notch range for noise floor estimate in STEP_CALC_FREQUENCIES
+static FAST_CODE void calcNoiseSum(const int axis)
+{
+    sdftNoiseThreshold[axis] = 0.0f;
+    for (int bin = (sdftStartBin + 1); bin < sdftEndBin; bin++) {   // don't use startBin or endBin because they are not windowed properly
+        sdftNoiseThreshold[axis] += sdftData[axis][bin];            // sdftData contains power spectral density
+    }
+}
+
+static FAST_CODE void detectPeaks(const int axis)
+{
+    const float *data = sdftData[axis];
+    peak_t *axisPeaks = peaks[axis];
+
+    // Get memory ready for new peak data on current axis
+    for (int p = 0; p < dynNotch.count; p++) {
+        axisPeaks[p].bin = 0;
+        axisPeaks[p].value = 0.0f;
+    }
+
+    // Search for N biggest peaks in frequency spectrum
+    for (int bin = (sdftStartBin + 1); bin < sdftEndBin; bin++) {
+        // Check if bin is peak
+        if ((data[bin] > data[bin - 1]) && (data[bin] > data[bin + 1])) {
+            // Check if peak is big enough to be one of N biggest peaks.
+            // If so, insert peak and sort peaks in descending height order
+            for (int p = 0; p < dynNotch.count; p++) {
+                if (data[bin] > axisPeaks[p].value) {
+                    for (int k = dynNotch.count - 1; k > p; k--) {
+                        axisPeaks[k] = axisPeaks[k - 1];
+                    }
+                    axisPeaks[p].bin = bin;
+                    axisPeaks[p].value = data[bin];
+                    break;
+                }
+            }
+            bin++; // If bin is peak, next bin can't be peak => jump it
+        }
+    }
+
+    // Sort N biggest peaks in ascending bin order (example: 3, 8, 25, 0, 0, ..., 0)
+    for (int p = dynNotch.count - 1; p > 0; p--) {
+        for (int k = 0; k < p; k++) {
+            // Swap peaks but ignore swapping void peaks (bin = 0). This leaves
+            // void peaks at the end of peaks array without moving them
+            if (axisPeaks[k].bin > axisPeaks[k + 1].bin && axisPeaks[k + 1].bin != 0) {
+                peak_t temp = axisPeaks[k];
+                axisPeaks[k] = axisPeaks[k + 1];
+                axisPeaks[k + 1] = temp;
+            }
+        }
+    }
+}
+
+static FAST_CODE void calcFrequencies(const int axis)
+{
+    const float *data = sdftData[axis];
+    const peak_t *axisPeaks = peaks[axis];
+
+    // Approximate noise floor (= average power spectral density in dyn notch range, excluding peaks)
+    int peakCount = 0;
+    for (int p = 0; p < dynNotch.count; p++) {
+        if (axisPeaks[p].bin != 0) {
+            sdftNoiseThreshold[axis] -= 0.75f * data[axisPeaks[p].bin - 1];
+            sdftNoiseThreshold[axis] -= data[axisPeaks[p].bin];
+            sdftNoiseThreshold[axis] -= 0.75f * data[axisPeaks[p].bin + 1];
+            peakCount++;
+        }
+    }
+    sdftNoiseThreshold[axis] /= sdftEndBin - sdftStartBin - peakCount - 1;
+
+    // A noise threshold 2 times the noise floor prevents peak tracking being too sensitive to noise
+    sdftNoiseThreshold[axis] *= 2.0f;
+
+    for (int p = 0; p < dynNotch.count; p++) {
+
+        // Only update dynNotch.centerFreq if there is a peak (ignore void peaks) and if peak is above noise floor
+        if (axisPeaks[p].bin != 0 && axisPeaks[p].value > sdftNoiseThreshold[axis]) {
+
+            float meanBin = axisPeaks[p].bin;
+
+            // Height of peak bin (y1) and shoulder bins (y0, y2)
+            const float y0 = data[axisPeaks[p].bin - 1];
+            const float y1 = data[axisPeaks[p].bin];
+            const float y2 = data[axisPeaks[p].bin + 1];
+
+            // Estimate true peak position aka. meanBin (fit parabola y(x) over y0, y1 and y2, solve dy/dx=0 for x)
+            const float denom = 2.0f * (y0 - 2 * y1 + y2);
+            if (denom != 0.0f) {
+                meanBin += (y0 - y2) / denom;
+            }
+
+            // Convert bin to frequency: freq = bin * binResoultion (bin 0 is 0Hz)
+            const float centerFreq = constrainf(meanBin * sdftResolutionHz, dynNotch.minHz, dynNotch.maxHz);
+
+            // PT1 style smoothing moves notch center freqs rapidly towards big peaks and slowly away, up to 10x faster 
+            const float cutoffMult = constrainf(axisPeaks[p].value / sdftNoiseThreshold[axis], 1.0f, 10.0f);
+            const float gain = pt1FilterGain(DYN_NOTCH_SMOOTH_HZ * cutoffMult, pt1LooptimeS); // dynamic PT1 k value
+
+            // Finally update notch center frequency p on current axis
+            dynNotch.centerFreq[axis][p] += gain * (centerFreq - dynNotch.centerFreq[axis][p]);
+        }
+    }
+
+    if(calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
+        for (int p = 0; p < dynNotch.count; p++) {
+            dynNotch.maxCenterFreq = MAX(dynNotch.maxCenterFreq, dynNotch.centerFreq[axis][p]);
+        }
+    }
+
+    if (axis == gyro.gyroDebugAxis) {
+        for (int p = 0; p < dynNotch.count && p < 3; p++) {
+            DEBUG_SET(DEBUG_FFT_FREQ, p, lrintf(dynNotch.centerFreq[axis][p]));
+        }
+        DEBUG_SET(DEBUG_DYN_LPF, 1, lrintf(dynNotch.centerFreq[axis][0]));
+    }
+}
+
+// Only update notch filter coefficients if the corresponding peak got its center frequency updated in the previous step
+static FAST_CODE bool isPeakTracked(const int axis, const int p)
+{
+    return peaks[axis][p].bin != 0 && peaks[axis][p].value > sdftNoiseThreshold[axis];
+}
+
 // Find frequency peaks and update filters
 static FAST_CODE_NOINLINE void dynNotchProcess(void)
 {
-    uint32_t startTime = 0;
+    uint32_t startCycles = 0;
     if (debugMode == DEBUG_FFT_TIME) {
-        startTime = micros();
+        startCycles = getCycleCounter();
     }
 
     DEBUG_SET(DEBUG_FFT_TIME, 0, state.step);
@@ -261,142 +444,92 @@ static FAST_CODE_NOINLINE void dynNotchProcess(void)
     
         case STEP_WINDOW: // 4.1us (3-6us) @ F722
         {
-            sdftWinSq(&sdft[state.axis], sdftData);
-            
-            // Get total vibrational power in dyn notch range for noise floor estimate in STEP_CALC_FREQUENCIES
-            sdftNoiseThreshold = 0.0f;
-            for (int bin = (sdftStartBin + 1); bin < sdftEndBin; bin++) {   // don't use startBin or endBin because they are not windowed properly
-                sdftNoiseThreshold += sdftData[bin];                        // sdftData contains power spectral density
-            }
-
-            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+            sdftWinSq(&sdft.stepped[state.axis], sdftData[state.axis]);
+            calcNoiseSum(state.axis);
 
             break;
         }
         case STEP_DETECT_PEAKS: // 5.5us (4-7us) @ F722
         {
-            // Get memory ready for new peak data on current axis
-            for (int p = 0; p < dynNotch.count; p++) {
-                peaks[p].bin = 0;
-                peaks[p].value = 0.0f;
-            }
-
-            // Search for N biggest peaks in frequency spectrum
-            for (int bin = (sdftStartBin + 1); bin < sdftEndBin; bin++) {
-                // Check if bin is peak
-                if ((sdftData[bin] > sdftData[bin - 1]) && (sdftData[bin] > sdftData[bin + 1])) {
-                    // Check if peak is big enough to be one of N biggest peaks.
-                    // If so, insert peak and sort peaks in descending height order
-                    for (int p = 0; p < dynNotch.count; p++) {
-                        if (sdftData[bin] > peaks[p].value) {
-                            for (int k = dynNotch.count - 1; k > p; k--) {
-                                peaks[k] = peaks[k - 1];
-                            }
-                            peaks[p].bin = bin;
-                            peaks[p].value = sdftData[bin];
-                            break;
-                        }
-                    }
-                    bin++; // If bin is peak, next bin can't be peak => jump it
-                }
-            }
-
-            // Sort N biggest peaks in ascending bin order (example: 3, 8, 25, 0, 0, ..., 0)
-            for (int p = dynNotch.count - 1; p > 0; p--) {
-                for (int k = 0; k < p; k++) {
-                    // Swap peaks but ignore swapping void peaks (bin = 0). This leaves
-                    // void peaks at the end of peaks array without moving them
-                    if (peaks[k].bin > peaks[k + 1].bin && peaks[k + 1].bin != 0) {
-                        peak_t temp = peaks[k];
-                        peaks[k] = peaks[k + 1];
-                        peaks[k + 1] = temp;
-                    }
-                }
-            }
-
-            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+            detectPeaks(state.axis);
 
             break;
         }
         case STEP_CALC_FREQUENCIES: // 4.0us (2-7us) @ F722
         {
-            // Approximate noise floor (= average power spectral density in dyn notch range, excluding peaks)
-            int peakCount = 0;
+            calcFrequencies(state.axis);
+
+            break;
+        }
+        case STEP_UPDATE_FILTERS: // 5.4us (2-9us) @ F722
+        {
             for (int p = 0; p < dynNotch.count; p++) {
-                if (peaks[p].bin != 0) {
-                    sdftNoiseThreshold -= 0.75f * sdftData[peaks[p].bin - 1];
-                    sdftNoiseThreshold -= sdftData[peaks[p].bin];
-                    sdftNoiseThreshold -= 0.75f * sdftData[peaks[p].bin + 1];
-                    peakCount++;
+                if (isPeakTracked(state.axis, p)) {
+                    biquadFilterUpdate(&dynNotch.notch[state.axis][p], dynNotch.centerFreq[state.axis][p], dynNotch.looptimeUs, dynNotch.q, FILTER_NOTCH, 1.0f);
                 }
             }
-            sdftNoiseThreshold /= sdftEndBin - sdftStartBin - peakCount - 1;
 
-            // A noise threshold 2 times the noise floor prevents peak tracking being too sensitive to noise
-            sdftNoiseThreshold *= 2.0f;
-
-            for (int p = 0; p < dynNotch.count; p++) {
-
-                // Only update dynNotch.centerFreq if there is a peak (ignore void peaks) and if peak is above noise floor
-                if (peaks[p].bin != 0 && peaks[p].value > sdftNoiseThreshold) {
+            state.axis = (state.axis + 1) % XYZ_AXIS_COUNT;
+        }
+    }
 
-                    float meanBin = peaks[p].bin;
+    DEBUG_SET(DEBUG_FFT_TIME, 1, MIN(getCycleCounter() - startCycles, (uint32_t)INT16_MAX));
 
-                    // Height of peak bin (y1) and shoulder bins (y0, y2)
-                    const float y0 = sdftData[peaks[p].bin - 1];
-                    const float y1 = sdftData[peaks[p].bin];
-                    const float y2 = sdftData[peaks[p].bin + 1];
+    state.step = (state.step + 1) % STEP_COUNT;
+}
 
-                    // Estimate true peak position aka. meanBin (fit parabola y(x) over y0, y1 and y2, solve dy/dx=0 for x)
-                    const float denom = 2.0f * (y0 - 2 * y1 + y2);
-                    if (denom != 0.0f) {
-                        meanBin += (y0 - y2) / denom;
-                    }
+// Run one step of the peak search for all three axes
+static FAST_CODE_NOINLINE void dynNotchProcessAllAxes(void)
+{
+    uint32_t startCycles = 0;
+    if (debugMode == DEBUG_FFT_TIME) {
+        startCycles = getCycleCounter();
+    }
 
-                    // Convert bin to frequency: freq = bin * binResoultion (bin 0 is 0Hz)
-                    const float centerFreq = constrainf(meanBin * sdftResolutionHz, dynNotch.minHz, dynNotch.maxHz);
+    DEBUG_SET(DEBUG_FFT_TIME, 0, state.step);
 
-                    // PT1 style smoothing moves notch center freqs rapidly towards big peaks and slowly away, up to 10x faster 
-                    const float cutoffMult = constrainf(peaks[p].value / sdftNoiseThreshold, 1.0f, 10.0f);
-                    const float gain = pt1FilterGain(DYN_NOTCH_SMOOTH_HZ * cutoffMult, pt1LooptimeS); // dynamic PT1 k value
+    switch (state.step) {
 
-                    // Finally update notch center frequency p on current axis
-                    dynNotch.centerFreq[state.axis][p] += gain * (centerFreq - dynNotch.centerFreq[state.axis][p]);
-                }
+        case STEP_WINDOW:
+        {
+            sdftAxesWinSq(&sdft.allAxes.sdft, sdftData);
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                calcNoiseSum(axis);
             }
 
-            if(calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
-                for (int p = 0; p < dynNotch.count; p++) {
-                    dynNotch.maxCenterFreq = MAX(dynNotch.maxCenterFreq, dynNotch.centerFreq[state.axis][p]);
-                }
+            break;
+        }
+        case STEP_DETECT_PEAKS:
+        {
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                detectPeaks(axis);
             }
 
-            if (state.axis == gyro.gyroDebugAxis) {
-                for (int p = 0; p < dynNotch.count && p < 3; p++) {
-                    DEBUG_SET(DEBUG_FFT_FREQ, p, lrintf(dynNotch.centerFreq[state.axis][p]));
-                }
-                DEBUG_SET(DEBUG_DYN_LPF, 1, lrintf(dynNotch.centerFreq[state.axis][0]));
+            break;
+        }
+        case STEP_CALC_FREQUENCIES:
+        {
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                calcFrequencies(axis);
             }
 
-            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
-
             break;
         }
-        case STEP_UPDATE_FILTERS: // 5.4us (2-9us) @ F722
+        case STEP_UPDATE_FILTERS:
         {
-            for (int p = 0; p < dynNotch.count; p++) {
-                // Only update notch filter coefficients if the corresponding peak got its center frequency updated in the previous step
-                if (peaks[p].bin != 0 && peaks[p].value > sdftNoiseThreshold) {
-                    biquadFilterUpdate(&dynNotch.notch[state.axis][p], dynNotch.centerFreq[state.axis][p], dynNotch.looptimeUs, dynNotch.q, FILTER_NOTCH, 1.0f);
+            // table lookups keep the update of up to 3 * DYN_NOTCH_COUNT_MAX notches cheap
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                for (int p = 0; p < dynNotch.count; p++) {
+                    if (isPeakTracked(axis, p)) {
+                        biquadFilterUpdateFromNotchTable(&dynNotch.notch[axis][p], &sdft.allAxes.notchTable, dynNotch.centerFreq[axis][p] * dynNotch.looptimeS);
+                    }
                 }
             }
-
-            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
-
-            state.axis = (state.axis + 1) % XYZ_AXIS_COUNT;
         }
     }
 
+    DEBUG_SET(DEBUG_FFT_TIME, 1, MIN(getCycleCounter() - startCycles, (uint32_t)INT16_MAX));
+
     state.step = (state.step + 1) % STEP_COUNT;
 }
 
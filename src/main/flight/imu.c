@@ -112,12 +112,13 @@ quaternion offset = QUATERNION_INITIALIZE;
 // absolute angle inclination in multiple of 0.1 degree    180 deg = 1800
 attitudeEulerAngles_t attitude = EULER_INITIALIZE;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 2);
 
 PG_RESET_TEMPLATE(imuConfig_t, imuConfig,
     .dcm_kp = 2500,                // 1.0 * 10000
     .dcm_ki = 0,                   // 0.003 * 10000
     .small_angle = 25,
+    .estimator = IMU_ESTIMATOR_MAHONY,
 );
 
 static void imuQuaternionComputeProducts(quaternion *quat, quaternionProducts *quatProd)
@@ -172,6 +173,7 @@ void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correctio
 {
     imuRuntimeConfig.dcm_kp = imuConfig()->dcm_kp / 10000.0f;
     imuRuntimeConfig.dcm_ki = imuConfig()->dcm_ki / 10000.0f;
+    imuRuntimeConfig.estimator = imuConfig()->estimator;
 
     smallAngleCosZ = cos_approx(degreesToRadians(imuConfig()->small_angle));
 
@@ -204,10 +206,13 @@ static float invSqrt(float x)
     return 1.0f / sqrtf(x);
 }
 
-static void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
+// deltaAngle is the coning corrected gyro rotation vector (radians) since the last update, or NULL to
+// integrate the average rate gx, gy, gz in a single first order step
+STATIC_UNIT_TESTED void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
                                 bool useAcc, float ax, float ay, float az,
                                 bool useMag,
-                                bool useCOG, float courseOverGround, const float dcmKpGain)
+                                bool useCOG, float courseOverGround, const float dcmKpGain,
+                                const float *deltaAngle)
 {
     static float integralFBx = 0.0f,  integralFBy = 0.0f, integralFBz = 0.0f;    // integral error terms scaled by Ki
 
@@ -296,26 +301,46 @@ static void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
         integralFBz = 0.0f;
     }
 
-    // Apply proportional and integral feedback
-    gx += dcmKpGain * ex + integralFBx;
-    gy += dcmKpGain * ey + integralFBy;
-    gz += dcmKpGain * ez + integralFBz;
-
-    // Integrate rate of change of quaternion
-    gx *= (0.5f * dt);
-    gy *= (0.5f * dt);
-    gz *= (0.5f * dt);
-
     quaternion buffer;
     buffer.w = q.w;
     buffer.x = q.x;
     buffer.y = q.y;
     buffer.z = q.z;
 
-    q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
-    q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
-    q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
-    q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
+    if (deltaAngle) {
+        // Rotation vector of the gyro delta-angle plus proportional and integral feedback
+        const float rx = deltaAngle[X] + (dcmKpGain * ex + integralFBx) * dt;
+        const float ry = deltaAngle[Y] + (dcmKpGain * ey + integralFBy) * dt;
+        const float rz = deltaAngle[Z] + (dcmKpGain * ez + integralFBz) * dt;
+
+        // Exact quaternion of the rotation vector, cos and sin(|r|/2)/|r| expanded to fifth order
+        const float halfAngleSq = 0.25f * (sq(rx) + sq(ry) + sq(rz));
+        const float dqw = 1.0f - halfAngleSq * (0.5f - halfAngleSq * (1.0f / 24.0f));
+        const float dqScale = 0.5f * (1.0f - halfAngleSq * (1.0f / 6.0f - halfAngleSq * (1.0f / 120.0f)));
+        const float dqx = rx * dqScale;
+        const float dqy = ry * dqScale;
+        const float dqz = rz * dqScale;
+
+        q.w = buffer.w * dqw - buffer.x * dqx - buffer.y * dqy - buffer.z * dqz;
+        q.x = buffer.w * dqx + buffer.x * dqw + buffer.y * dqz - buffer.z * dqy;
+        q.y = buffer.w * dqy - buffer.x * dqz + buffer.y * dqw + buffer.z * dqx;
+        q.z = buffer.w * dqz + buffer.x * dqy - buffer.y * dqx + buffer.z * dqw;
+    } else {
+        // Apply proportional and integral feedback
+        gx += dcmKpGain * ex + integralFBx;
+        gy += dcmKpGain * ey + integralFBy;
+        gz += dcmKpGain * ez + integralFBz;
+
+        // Integrate rate of change of quaternion
+        gx *= (0.5f * dt);
+        gy *= (0.5f * dt);
+        gz *= (0.5f * dt);
+
+        q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
+        q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
+        q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
+        q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
+    }
 
     // Normalise quaternion
     float recipNorm = invSqrt(sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z));
@@ -535,6 +560,9 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
 //  printf("[imu]deltaT = %u, imuDeltaT = %u, currentTimeUs = %u, micros64_real = %lu\n", deltaT, imuDeltaT, currentTimeUs, micros64_real());
     deltaT = imuDeltaT;
 #endif
+    // the delta-angle is always collected so it does not build up while the Mahony step is selected
+    float gyroDeltaAngle[XYZ_AXIS_COUNT];
+    const bool hasDeltaAngle = gyroGetAccumulatedDeltaAngle(gyroDeltaAngle);
     float gyroAverage[XYZ_AXIS_COUNT];
     gyroGetAccumulationAverage(gyroAverage);
 
@@ -546,7 +574,8 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
                         DEGREES_TO_RADIANS(gyroAverage[X]), DEGREES_TO_RADIANS(gyroAverage[Y]), DEGREES_TO_RADIANS(gyroAverage[Z]),
                         useAcc, accAverage[X], accAverage[Y], accAverage[Z],
                         useMag,
-                        useCOG, courseOverGround,  imuCalcKpGain(currentTimeUs, useAcc, gyroAverage));
+                        useCOG, courseOverGround,  imuCalcKpGain(currentTimeUs, useAcc, gyroAverage),
+                        (imuRuntimeConfig.estimator == IMU_ESTIMATOR_DELTA_ANGLE && hasDeltaAngle) ? gyroDeltaAngle : NULL);
 
     imuUpdateEulerAngles();
 #endif
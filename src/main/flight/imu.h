@@ -53,10 +53,17 @@ typedef union {
 extern attitudeEulerAngles_t attitude;
 extern float rMat[3][3];
 
+typedef enum {
+    IMU_ESTIMATOR_MAHONY = 0,               // single integration step from the average gyro rate
+    IMU_ESTIMATOR_DELTA_ANGLE,              // exact rotation by the coning corrected gyro delta-angle
+    IMU_ESTIMATOR_COUNT
+} imuEstimator_e;
+
 typedef struct imuConfig_s {
     uint16_t dcm_kp;                        // DCM filter proportional gain ( x 10000)
     uint16_t dcm_ki;                        // DCM filter integral gain ( x 10000)
     uint8_t small_angle;
+    uint8_t estimator;                      // imuEstimator_e
 } imuConfig_t;
 
 PG_DECLARE(imuConfig_t, imuConfig);
@@ -64,6 +71,7 @@ PG_DECLARE(imuConfig_t, imuConfig);
 typedef struct imuRuntimeConfig_s {
     float dcm_ki;
     float dcm_kp;
+    uint8_t estimator;
 } imuRuntimeConfig_t;
 
 void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correction_value);
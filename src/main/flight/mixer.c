@@ -344,12 +344,15 @@ static void applyFlipOverAfterCrashModeToMotors(void)
     }
 }
 
-static void applyMixToMotors(float motorMix[MAX_SUPPORTED_MOTORS], motorMixer_t *activeMixer)
+static void applyMixToMotors(const float motorMix[MAX_SUPPORTED_MOTORS], const float motorMixScale, const mixerMatrix_t *activeMatrix)
 {
+    // desaturation scale from applyMixerAdjustment() folded in here rather than rescaling motorMix separately
+    const float motorMixGain = motorOutputMixSign * motorMixScale;
+
     // Now add in the desired throttle, but keep in a range that doesn't clip adjusted
     // roll/pitch/yaw. This could move throttle down, but also up for those low throttle flips.
     for (int i = 0; i < mixerRuntime.motorCount; i++) {
-        float motorOutput = motorOutputMixSign * motorMix[i] + throttle * activeMixer[i].throttle;
+        float motorOutput = motorMixGain * motorMix[i] + throttle * activeMatrix->throttle[i];
 #ifdef USE_THRUST_LINEARIZATION
         motorOutput = pidApplyThrustLinearization(motorOutput);
 #endif
@@ -439,17 +442,17 @@ static void applyMixerAdjustmentLinear(float *motorMix, const bool airmodeEnable
     }
 }
 
-static void applyMixerAdjustment(float *motorMix, const float motorMixMin, const float motorMixMax, const bool airmodeEnabled) {
+// Returns the scale to apply to motorMix, applied when the mix is added to the motor outputs
+static float applyMixerAdjustment(const float motorMixMin, const float motorMixMax, const bool airmodeEnabled) {
 #ifdef USE_AIRMODE_LPF
     const float unadjustedThrottle = throttle;
     throttle += pidGetAirmodeThrottleOffset();
     float airmodeThrottleChange = 0;
 #endif
+    float motorMixScale = 1.0f;
 
     if (motorMixRange > 1.0f) {
-        for (int i = 0; i < mixerRuntime.motorCount; i++) {
-            motorMix[i] /= motorMixRange;
-        }
+        motorMixScale = 1.0f / motorMixRange;
         // Get the maximum correction by setting offset to center when airmode enabled
         if (airmodeEnabled) {
             throttle = 0.5f;
@@ -466,6 +469,8 @@ static void applyMixerAdjustment(float *motorMix, const float motorMixMin, const
 #ifdef USE_AIRMODE_LPF
     pidUpdateAirmodeLpf(airmodeThrottleChange);
 #endif
+
+    return motorMixScale;
 }
 
 FAST_CODE_NOINLINE void mixTable(timeUs_t currentTimeUs)
@@ -481,10 +486,10 @@ FAST_CODE_NOINLINE void mixTable(timeUs_t currentTimeUs)
 
     const bool launchControlActive = isLaunchControlActive();
 
-    motorMixer_t * activeMixer = &mixerRuntime.currentMixer[0];
+    const mixerMatrix_t *activeMatrix = &mixerRuntime.currentMatrix;
 #ifdef USE_LAUNCH_CONTROL
     if (launchControlActive && (currentPidProfile->launchControlMode == LAUNCH_CONTROL_MODE_PITCHONLY)) {
-        activeMixer = &mixerRuntime.launchControlMixer[0];
+        activeMatrix = &mixerRuntime.launchControlMatrix;
     }
 #endif
 
@@ -551,20 +556,18 @@ FAST_CODE_NOINLINE void mixTable(timeUs_t currentTimeUs)
 
     // Find roll/pitch/yaw desired output
     // ??? Where is the optimal location for this code?
+    // Runs over every matrix slot rather than motorCount so the loop has a constant trip count and unrolls,
+    // unused slots are zero and mix to 0 which leaves the min/max untouched
     float motorMix[MAX_SUPPORTED_MOTORS];
     float motorMixMax = 0, motorMixMin = 0;
-    for (int i = 0; i < mixerRuntime.motorCount; i++) {
-
-        float mix =
-            scaledAxisPidRoll  * activeMixer[i].roll +
-            scaledAxisPidPitch * activeMixer[i].pitch +
-            scaledAxisPidYaw   * activeMixer[i].yaw;
-
-        if (mix > motorMixMax) {
-            motorMixMax = mix;
-        } else if (mix < motorMixMin) {
-            motorMixMin = mix;
-        }
+    for (int i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
+        const float mix =
+            scaledAxisPidRoll  * activeMatrix->roll[i] +
+            scaledAxisPidPitch * activeMatrix->pitch[i] +
+            scaledAxisPidYaw   * activeMatrix->yaw[i];
+
+        motorMixMax = MAX(motorMixMax, mix);
+        motorMixMin = MIN(motorMixMin, mix);
         motorMix[i] = mix;
     }
 
@@ -596,10 +599,11 @@ FAST_CODE_NOINLINE void mixTable(timeUs_t currentTimeUs)
 #endif
 
     motorMixRange = motorMixMax - motorMixMin;
+    float motorMixScale = 1.0f;
     if (mixerConfig()->mixer_type > MIXER_LEGACY) {
         applyMixerAdjustmentLinear(motorMix, airmodeEnabled);
     } else {
-        applyMixerAdjustment(motorMix, motorMixMin, motorMixMax, airmodeEnabled);
+        motorMixScale = applyMixerAdjustment(motorMixMin, motorMixMax, airmodeEnabled);
     }
 
     if (featureIsEnabled(FEATURE_MOTOR_STOP)
@@ -612,7 +616,7 @@ FAST_CODE_NOINLINE void mixTable(timeUs_t currentTimeUs)
         applyMotorStop();
     } else {
         // Apply the mix to motor endpoints
-        applyMixToMotors(motorMix, activeMixer);
+        applyMixToMotors(motorMix, motorMixScale, activeMatrix);
     }
 }
 
@@ -324,6 +324,17 @@ void mixerInitProfile(void)
 #endif
 }
 
+static void mixerLoadMatrix(mixerMatrix_t *matrix, const motorMixer_t *mixer)
+{
+    memset(matrix, 0, sizeof(*matrix));
+    for (int i = 0; i < mixerRuntime.motorCount; i++) {
+        matrix->roll[i] = mixer[i].roll;
+        matrix->pitch[i] = mixer[i].pitch;
+        matrix->yaw[i] = mixer[i].yaw;
+        matrix->throttle[i] = mixer[i].throttle;
+    }
+}
+
 #ifdef USE_LAUNCH_CONTROL
 // Create a custom mixer for launch control based on the current settings
 // but disable the front motors. We don't care about roll or yaw because they
@@ -338,6 +349,7 @@ void loadLaunchControlMixer(void)
             mixerRuntime.launchControlMixer[i].throttle = 0.0f;
         }
     }
+    mixerLoadMatrix(&mixerRuntime.launchControlMatrix, mixerRuntime.launchControlMixer);
 }
 #endif
 
@@ -368,6 +380,7 @@ static void mixerConfigureOutput(void)
                 mixerRuntime.currentMixer[i] = mixers[currentMixerMode].motor[i];
         }
     }
+    mixerLoadMatrix(&mixerRuntime.currentMatrix, mixerRuntime.currentMixer);
 #ifdef USE_LAUNCH_CONTROL
     loadLaunchControlMixer();
 #endif
@@ -396,6 +409,7 @@ static void mixerConfigureOutput(void)
     for (int i = 0; i < mixerRuntime.motorCount; i++) {
         mixerRuntime.currentMixer[i] = mixerQuadX[i];
     }
+    mixerLoadMatrix(&mixerRuntime.currentMatrix, mixerRuntime.currentMixer);
 #ifdef USE_LAUNCH_CONTROL
     loadLaunchControlMixer();
 #endif
@@ -25,11 +25,21 @@
 #include "flight/mixer.h"
 
 
+// Mixer coefficients packed per axis for mixTable(), entries past motorCount are zero
+typedef struct mixerMatrix_s {
+    float roll[MAX_SUPPORTED_MOTORS];
+    float pitch[MAX_SUPPORTED_MOTORS];
+    float yaw[MAX_SUPPORTED_MOTORS];
+    float throttle[MAX_SUPPORTED_MOTORS];
+} mixerMatrix_t;
+
 typedef struct mixerRuntime_s {
     uint8_t motorCount;
     motorMixer_t currentMixer[MAX_SUPPORTED_MOTORS];
+    mixerMatrix_t currentMatrix;
 #ifdef USE_LAUNCH_CONTROL
     motorMixer_t launchControlMixer[MAX_SUPPORTED_MOTORS];
+    mixerMatrix_t launchControlMatrix;
 #endif
     bool feature3dEnabled;
     float motorOutputLow;
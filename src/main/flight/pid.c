@@ -87,7 +87,7 @@ FAST_DATA_ZERO_INIT float throttleBoost;
 pt1Filter_t throttleLpf;
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 3);
+PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 4);
 
 #if defined(STM32F1)
 #define PID_PROCESS_DENOM_DEFAULT       8
@@ -104,11 +104,13 @@ PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
     .pid_process_denom = PID_PROCESS_DENOM_DEFAULT,
     .runaway_takeoff_prevention = true,
     .runaway_takeoff_deactivate_throttle = 20,  // throttle level % needed to accumulate deactivation time
-    .runaway_takeoff_deactivate_delay = 500     // Accumulated time (in milliseconds) before deactivation in successful takeoff
+    .runaway_takeoff_deactivate_delay = 500,    // Accumulated time (in milliseconds) before deactivation in successful takeoff
+    .fused_pid_loop = false,
 );
 #else
 PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
-    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT
+    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT,
+    .fused_pid_loop = false,
 );
 #endif
 
@@ -818,18 +820,31 @@ static FAST_CODE_NOINLINE float applyLaunchControl(int axis, const rollAndPitchT
 }
 #endif
 
-// Betaflight pid controller, which will be maintained in the future with additional features specialised for current (mini) multirotor usage.
-// Based on 2DOF reference design (matlab)
-void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
-{
-    static float previousGyroRateDterm[XYZ_AXIS_COUNT];
-    static float previousRawGyroRateDterm[XYZ_AXIS_COUNT];
+// Features a pidController variant is built with. Each one gates work that is a no-op while its condition is
+// false, so any variant whose mask covers the features required this loop computes the same result.
+typedef enum {
+    PID_FEATURE_LEVEL           = (1 << 0),
+    PID_FEATURE_CRASH_RECOVERY  = (1 << 1),
+    PID_FEATURE_ACRO_TRAINER    = (1 << 2),
+    PID_FEATURE_LAUNCH_CONTROL  = (1 << 3),
+    PID_FEATURE_YAW_SPIN        = (1 << 4),
+} pidFeature_e;
+
+#define PID_FEATURE_ALL (PID_FEATURE_LEVEL | PID_FEATURE_CRASH_RECOVERY | PID_FEATURE_ACRO_TRAINER | PID_FEATURE_LAUNCH_CONTROL | PID_FEATURE_YAW_SPIN)
+
+static FAST_DATA_ZERO_INIT float previousGyroRateDterm[XYZ_AXIS_COUNT];
+static FAST_DATA_ZERO_INIT float previousRawGyroRateDterm[XYZ_AXIS_COUNT];
 
 #if defined(USE_ACC)
-    static timeUs_t levelModeStartTimeUs = 0;
-    static bool gpsRescuePreviousState = false;
+static FAST_DATA_ZERO_INIT timeUs_t levelModeStartTimeUs;
+static FAST_DATA_ZERO_INIT bool gpsRescuePreviousState;
 #endif
 
+// Betaflight pid controller, which will be maintained in the future with additional features specialised for current (mini) multirotor usage.
+// Based on 2DOF reference design (matlab)
+// features is a compile time constant in every caller, so the branches for unused features fold away.
+static ALWAYS_INLINE void pidControllerApply(const pidProfile_t *pidProfile, timeUs_t currentTimeUs, const uint8_t features)
+{
 #if defined(USE_ACC)
     const rollAndPitchTrims_t *angleTrim = &accelerometerConfig()->accelerometerTrims;
 #else
@@ -844,35 +859,38 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #endif
 
 #ifdef USE_YAW_SPIN_RECOVERY
-    const bool yawSpinActive = gyroYawSpinDetected();
+    const bool yawSpinActive = (features & PID_FEATURE_YAW_SPIN) && gyroYawSpinDetected();
 #endif
 
-    const bool launchControlActive = isLaunchControlActive();
+    const bool launchControlActive = (features & PID_FEATURE_LAUNCH_CONTROL) && isLaunchControlActive();
 
 #if defined(USE_ACC)
-    const bool gpsRescueIsActive = FLIGHT_MODE(GPS_RESCUE_MODE);
-    levelMode_e levelMode;
-    if (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE) || gpsRescueIsActive) {
-        if (pidRuntime.levelRaceMode && !gpsRescueIsActive) {
-            levelMode = LEVEL_MODE_R;
-        } else {
-            levelMode = LEVEL_MODE_RP;
+    levelMode_e levelMode = LEVEL_MODE_OFF;
+    if (features & PID_FEATURE_LEVEL) {
+        const bool gpsRescueIsActive = FLIGHT_MODE(GPS_RESCUE_MODE);
+        if (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE) || gpsRescueIsActive) {
+            if (pidRuntime.levelRaceMode && !gpsRescueIsActive) {
+                levelMode = LEVEL_MODE_R;
+            } else {
+                levelMode = LEVEL_MODE_RP;
+            }
         }
-    } else {
-        levelMode = LEVEL_MODE_OFF;
-    }
 
-    // Keep track of when we entered a self-level mode so that we can
-    // add a guard time before crash recovery can activate.
-    // Also reset the guard time whenever GPS Rescue is activated.
-    if (levelMode) {
-        if ((levelModeStartTimeUs == 0) || (gpsRescueIsActive && !gpsRescuePreviousState)) {
-            levelModeStartTimeUs = currentTimeUs;
+        // Keep track of when we entered a self-level mode so that we can
+        // add a guard time before crash recovery can activate.
+        // Also reset the guard time whenever GPS Rescue is activated.
+        if (levelMode) {
+            if ((levelModeStartTimeUs == 0) || (gpsRescueIsActive && !gpsRescuePreviousState)) {
+                levelModeStartTimeUs = currentTimeUs;
+            }
+        } else {
+            levelModeStartTimeUs = 0;
         }
+        gpsRescuePreviousState = gpsRescueIsActive;
     } else {
         levelModeStartTimeUs = 0;
+        gpsRescuePreviousState = false;
     }
-    gpsRescuePreviousState = gpsRescueIsActive;
 #endif
 
     // Dynamic i component,
@@ -968,7 +986,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #endif
 
 #ifdef USE_ACRO_TRAINER
-        if ((axis != FD_YAW) && pidRuntime.acroTrainerActive && !pidRuntime.inCrashRecoveryMode && !launchControlActive) {
+        if ((features & PID_FEATURE_ACRO_TRAINER) && (axis != FD_YAW) && pidRuntime.acroTrainerActive && !pidRuntime.inCrashRecoveryMode && !launchControlActive) {
             currentPidSetpoint = applyAcroTrainer(axis, angleTrim, currentPidSetpoint);
         }
 #endif // USE_ACRO_TRAINER
@@ -995,9 +1013,11 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         const float gyroRate = gyro.gyroADCf[axis]; // Process variable from gyro output in deg/sec
         float errorRate = currentPidSetpoint - gyroRate; // r - y
 #if defined(USE_ACC)
-        handleCrashRecovery(
-            pidProfile->crash_recovery, angleTrim, axis, currentTimeUs, gyroRate,
-            &currentPidSetpoint, &errorRate);
+        if (features & PID_FEATURE_CRASH_RECOVERY) {
+            handleCrashRecovery(
+                pidProfile->crash_recovery, angleTrim, axis, currentTimeUs, gyroRate,
+                &currentPidSetpoint, &errorRate);
+        }
 #endif
 
         const float previousIterm = pidData[axis].I;
@@ -1007,7 +1027,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #endif
 
 #if defined(USE_ITERM_RELAX)
-        if (!launchControlActive && !pidRuntime.inCrashRecoveryMode) {
+        if (!launchControlActive && !((features & PID_FEATURE_CRASH_RECOVERY) && pidRuntime.inCrashRecoveryMode)) {
             applyItermRelax(axis, previousIterm, gyroRate, &itermErrorRate, &currentPidSetpoint);
             errorRate = currentPidSetpoint - gyroRate;
         }
@@ -1064,7 +1084,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
             float preTpaD = pidRuntime.pidCoefficient[axis].Kd * delta;
 
 #if defined(USE_ACC)
-            if (cmpTimeUs(currentTimeUs, levelModeStartTimeUs) > CRASH_RECOVERY_DETECTION_DELAY_US) {
+            if ((features & PID_FEATURE_CRASH_RECOVERY) && cmpTimeUs(currentTimeUs, levelModeStartTimeUs) > CRASH_RECOVERY_DETECTION_DELAY_US) {
                 detectAndSetCrashRecovery(pidProfile->crash_recovery, axis, currentTimeUs, delta, errorRate);
             }
 #endif
@@ -1124,7 +1144,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         float feedforwardGain = launchControlActive ? 0.0f : pidRuntime.pidCoefficient[axis].Kf;
         if (feedforwardGain > 0) {
             // halve feedforward in Level mode since stick sensitivity is weaker by about half
-            feedforwardGain *= FLIGHT_MODE(ANGLE_MODE) ? 0.5f : 1.0f;
+            feedforwardGain *= ((features & PID_FEATURE_LEVEL) && FLIGHT_MODE(ANGLE_MODE)) ? 0.5f : 1.0f;
             // transition now calculated in feedforward.c when new RC data arrives 
             float feedForward = feedforwardGain * pidSetpointDelta * pidRuntime.pidFrequency;
 
@@ -1211,6 +1231,99 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     }
 }
 
+typedef void (*pidControllerFn)(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+
+// Rate mode with no recovery features armed: the common race path
+STATIC_UNIT_TESTED FAST_CODE void pidControllerAcro(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
+{
+    pidControllerApply(pidProfile, currentTimeUs, 0);
+}
+
+STATIC_UNIT_TESTED FAST_CODE void pidControllerLevel(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
+{
+    pidControllerApply(pidProfile, currentTimeUs, PID_FEATURE_LEVEL | PID_FEATURE_CRASH_RECOVERY);
+}
+
+// Launch control and the catch-all variant are kept out of FAST_CODE to limit ITCM use
+STATIC_UNIT_TESTED void pidControllerLaunch(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
+{
+    pidControllerApply(pidProfile, currentTimeUs, PID_FEATURE_LAUNCH_CONTROL);
+}
+
+STATIC_UNIT_TESTED void pidControllerFull(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
+{
+    pidControllerApply(pidProfile, currentTimeUs, PID_FEATURE_ALL);
+}
+
+typedef struct pidControllerVariant_s {
+    uint8_t features;
+    pidControllerFn fn;
+} pidControllerVariant_t;
+
+// Ordered by preference, the last entry must cover every feature
+static const pidControllerVariant_t pidControllerVariants[] = {
+    { 0,                                                pidControllerAcro },
+    { PID_FEATURE_LEVEL | PID_FEATURE_CRASH_RECOVERY,  pidControllerLevel },
+    { PID_FEATURE_LAUNCH_CONTROL,                       pidControllerLaunch },
+    { PID_FEATURE_ALL,                                  pidControllerFull },
+};
+
+static FAST_DATA_ZERO_INIT uint8_t pidControllerFeatures;
+static FAST_DATA_ZERO_INIT pidControllerFn pidControllerSelected;
+
+static FAST_CODE uint8_t pidControllerRequiredFeatures(const pidProfile_t *pidProfile)
+{
+    uint8_t features = 0;
+
+#if defined(USE_ACC)
+    if (FLIGHT_MODE(ANGLE_MODE | HORIZON_MODE | GPS_RESCUE_MODE)) {
+        features |= PID_FEATURE_LEVEL;
+    }
+    if (pidProfile->crash_recovery || FLIGHT_MODE(GPS_RESCUE_MODE) || pidRuntime.inCrashRecoveryMode) {
+        features |= PID_FEATURE_CRASH_RECOVERY;
+    }
+#else
+    UNUSED(pidProfile);
+#endif
+#ifdef USE_ACRO_TRAINER
+    if (pidRuntime.acroTrainerActive) {
+        features |= PID_FEATURE_ACRO_TRAINER;
+    }
+#endif
+    if (isLaunchControlActive()) {
+        features |= PID_FEATURE_LAUNCH_CONTROL;
+    }
+#ifdef USE_YAW_SPIN_RECOVERY
+    if (gyroYawSpinDetected()) {
+        features |= PID_FEATURE_YAW_SPIN;
+    }
+#endif
+
+    return features;
+}
+
+static void pidControllerSelect(uint8_t features)
+{
+    for (unsigned i = 0; i < ARRAYLEN(pidControllerVariants); i++) {
+        if ((features & ~pidControllerVariants[i].features) == 0) {
+            pidControllerSelected = pidControllerVariants[i].fn;
+            break;
+        }
+    }
+    pidControllerFeatures = features;
+}
+
+void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs)
+{
+    // Only a handful of flag tests per loop; the variant is swapped when a mode or the profile changes what is needed
+    const uint8_t features = pidControllerRequiredFeatures(pidProfile);
+    if (features != pidControllerFeatures || !pidControllerSelected) {
+        pidControllerSelect(features);
+    }
+
+    pidControllerSelected(pidProfile, currentTimeUs);
+}
+
 bool crashRecoveryModeActive(void)
 {
     return pidRuntime.inCrashRecoveryMode;
@@ -1254,27 +1367,32 @@ void dynLpfDTermUpdate(float throttle)
         }
 
         switch (pidRuntime.dynLpfFilter) {
-        case DYN_LPF_PT1:
+        case DYN_LPF_PT1: {
+            const float gain = pt1FilterGain(cutoffFreq, pidRuntime.dT);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt1Filter, pt1FilterGain(cutoffFreq, pidRuntime.dT));
+                pt1FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt1Filter, gain);
             }
             break;
+        }
         case DYN_LPF_BIQUAD:
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterUpdateLPF(&pidRuntime.dtermLowpass[axis].biquadFilter, cutoffFreq, targetPidLooptime);
-            }
+            // coefficients are shared by all axes
+            biquadFilterCoeffsUpdateLPF(&pidRuntime.dtermLowpassCoeffs, cutoffFreq, targetPidLooptime);
             break;
-        case DYN_LPF_PT2:
+        case DYN_LPF_PT2: {
+            const float gain = pt2FilterGain(cutoffFreq, pidRuntime.dT);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt2FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt2Filter, pt2FilterGain(cutoffFreq, pidRuntime.dT));
+                pt2FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt2Filter, gain);
             }
             break;
-        case DYN_LPF_PT3:
+        }
+        case DYN_LPF_PT3: {
+            const float gain = pt3FilterGain(cutoffFreq, pidRuntime.dT);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt3FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt3Filter, pt3FilterGain(cutoffFreq, pidRuntime.dT));
+                pt3FilterUpdateCutoff(&pidRuntime.dtermLowpass[axis].pt3Filter, gain);
             }
             break;
         }
+        }
     }
 }
 #endif
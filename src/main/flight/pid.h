@@ -241,6 +241,7 @@ typedef struct pidConfig_s {
     uint8_t runaway_takeoff_prevention;          // off, on - enables pidsum runaway disarm logic
     uint16_t runaway_takeoff_deactivate_delay;   // delay in ms for "in-flight" conditions before deactivation (successful flight)
     uint8_t runaway_takeoff_deactivate_throttle; // minimum throttle percent required during deactivation phase
+    uint8_t fused_pid_loop;                      // off, on - run gyro filtering, PID and motor output in one pass
 } pidConfig_t;
 
 PG_DECLARE(pidConfig_t, pidConfig);
@@ -259,7 +260,7 @@ typedef struct pidAxisData_s {
 
 typedef union dtermLowpass_u {
     pt1Filter_t pt1Filter;
-    biquadFilter_t biquadFilter;
+    biquadFilterShared_t biquadFilter;
     pt2Filter_t pt2Filter;
     pt3Filter_t pt3Filter;
 } dtermLowpass_t;
@@ -277,11 +278,14 @@ typedef struct pidRuntime_s {
     bool pidStabilisationEnabled;
     float previousPidSetpoint[XYZ_AXIS_COUNT];
     filterApplyFnPtr dtermNotchApplyFn;
-    biquadFilter_t dtermNotch[XYZ_AXIS_COUNT];
+    biquadFilterShared_t dtermNotch[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t dtermNotchCoeffs;
     filterApplyFnPtr dtermLowpassApplyFn;
     dtermLowpass_t dtermLowpass[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t dtermLowpassCoeffs;
     filterApplyFnPtr dtermLowpass2ApplyFn;
     dtermLowpass_t dtermLowpass2[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t dtermLowpass2Coeffs;
     filterApplyFnPtr ptermYawLowpassApplyFn;
     pt1Filter_t ptermYawLowpass;
     bool antiGravityEnabled;
@@ -445,6 +449,10 @@ void rotateItermAndAxisError();
 float pidLevel(int axis, const pidProfile_t *pidProfile,
     const rollAndPitchTrims_t *angleTrim, float currentPidSetpoint);
 float calcHorizonLevelStrength(void);
+void pidControllerAcro(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+void pidControllerLevel(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+void pidControllerLaunch(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+void pidControllerFull(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
 #endif
 void dynLpfDTermUpdate(float throttle);
 void pidSetItermReset(bool enabled);
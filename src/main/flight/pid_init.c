@@ -92,10 +92,11 @@ void pidInitFilters(const pidProfile_t *pidProfile)
     }
 
     if (dTermNotchHz != 0 && pidProfile->dterm_notch_cutoff != 0) {
-        pidRuntime.dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        pidRuntime.dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterSharedApply;
         const float notchQ = filterGetNotchQ(dTermNotchHz, pidProfile->dterm_notch_cutoff);
+        biquadFilterCoeffsUpdate(&pidRuntime.dtermNotchCoeffs, dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH, 1.0f);
         for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-            biquadFilterInit(&pidRuntime.dtermNotch[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH, 1.0f);
+            biquadFilterSharedInit(&pidRuntime.dtermNotch[axis], &pidRuntime.dtermNotchCoeffs);
         }
     } else {
         pidRuntime.dtermNotchApplyFn = nullFilterApply;
@@ -121,12 +122,13 @@ void pidInitFilters(const pidProfile_t *pidProfile)
         case FILTER_BIQUAD:
             if (pidProfile->dterm_lpf1_static_hz < pidFrequencyNyquist) {
 #ifdef USE_DYN_LPF
-                pidRuntime.dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1;
+                pidRuntime.dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterSharedApplyDF1;
 #else
-                pidRuntime.dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
+                pidRuntime.dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterSharedApply;
 #endif
+                biquadFilterCoeffsUpdateLPF(&pidRuntime.dtermLowpassCoeffs, dterm_lpf1_init_hz, targetPidLooptime);
                 for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                    biquadFilterInitLPF(&pidRuntime.dtermLowpass[axis].biquadFilter, dterm_lpf1_init_hz, targetPidLooptime);
+                    biquadFilterSharedInit(&pidRuntime.dtermLowpass[axis].biquadFilter, &pidRuntime.dtermLowpassCoeffs);
                 }
             } else {
                 pidRuntime.dtermLowpassApplyFn = nullFilterApply;
@@ -163,9 +165,10 @@ void pidInitFilters(const pidProfile_t *pidProfile)
             break;
         case FILTER_BIQUAD:
             if (pidProfile->dterm_lpf2_static_hz < pidFrequencyNyquist) {
-                pidRuntime.dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+                pidRuntime.dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterSharedApply;
+                biquadFilterCoeffsUpdateLPF(&pidRuntime.dtermLowpass2Coeffs, pidProfile->dterm_lpf2_static_hz, targetPidLooptime);
                 for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                    biquadFilterInitLPF(&pidRuntime.dtermLowpass2[axis].biquadFilter, pidProfile->dterm_lpf2_static_hz, targetPidLooptime);
+                    biquadFilterSharedInit(&pidRuntime.dtermLowpass2[axis].biquadFilter, &pidRuntime.dtermLowpass2Coeffs);
                 }
             } else {
                 pidRuntime.dtermLowpassApplyFn = nullFilterApply;
@@ -48,7 +48,6 @@
 #define RPM_FILTER_MAXHARMONICS 3
 #define SECONDS_PER_MINUTE      60.0f
 #define ERPM_PER_LSB            100.0f
-#define MIN_UPDATE_T            0.001f
 
 
 static pt1Filter_t rpmFilters[MAX_SUPPORTED_MOTORS];
@@ -61,8 +60,10 @@ typedef struct rpmNotchFilter_s {
     float    fadeRangeHz;
     float    q;
     timeUs_t looptimeUs;
+    float    looptimeS;
 
-    biquadFilter_t notch[XYZ_AXIS_COUNT][MAX_SUPPORTED_MOTORS][RPM_FILTER_MAXHARMONICS];
+    // sections are ordered motor by motor, harmonics of one motor are adjacent
+    biquadNotchBank_t notch;
 
 } rpmNotchFilter_t;
 
@@ -70,18 +71,13 @@ FAST_DATA_ZERO_INIT static float   erpmToHz;
 FAST_DATA_ZERO_INIT static float   filteredMotorErpm[MAX_SUPPORTED_MOTORS];
 FAST_DATA_ZERO_INIT static float   motorFrequency[MAX_SUPPORTED_MOTORS];
 FAST_DATA_ZERO_INIT static float   minMotorFrequency;
-FAST_DATA_ZERO_INIT static uint8_t numberFilters;
 FAST_DATA_ZERO_INIT static uint8_t numberRpmNotchFilters;
-FAST_DATA_ZERO_INIT static uint8_t filterUpdatesPerIteration;
 FAST_DATA_ZERO_INIT static float   pidLooptime;
 FAST_DATA_ZERO_INIT static rpmNotchFilter_t filters[2];
 FAST_DATA_ZERO_INIT static rpmNotchFilter_t *gyroFilter;
 
-FAST_DATA_ZERO_INIT static uint8_t currentMotor;
-FAST_DATA_ZERO_INIT static uint8_t currentHarmonic;
-FAST_DATA_ZERO_INIT static uint8_t currentFilterNumber;
-FAST_DATA static rpmNotchFilter_t *currentFilter = &filters[0];
-
+// all notches share rpm_filter_q, so a single coefficient table serves every filter
+FAST_DATA_ZERO_INIT static biquadNotchTable_t notchTable;
 
 
 PG_REGISTER_WITH_RESET_FN(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 5);
@@ -98,28 +94,26 @@ void pgResetFn_rpmFilterConfig(rpmFilterConfig_t *config)
 
 static void rpmNotchFilterInit(rpmNotchFilter_t *filter, const rpmFilterConfig_t *config, const timeUs_t looptimeUs)
 {
-    filter->harmonics = config->rpm_filter_harmonics;
+    // with many motors there may not be enough bank sections for every harmonic
+    filter->harmonics = MIN(config->rpm_filter_harmonics, BIQUAD_NOTCH_BANK_SIZE / getMotorCount());
     filter->minHz = config->rpm_filter_min_hz;
     filter->maxHz = 0.48f * 1e6f / looptimeUs; // don't go quite to nyquist to avoid oscillations
     filter->fadeRangeHz = config->rpm_filter_fade_range_hz;
     filter->q = config->rpm_filter_q / 100.0f;
     filter->looptimeUs = looptimeUs;
+    filter->looptimeS = looptimeUs * 1e-6f;
 
-    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        for (int motor = 0; motor < getMotorCount(); motor++) {
-            for (int i = 0; i < filter->harmonics; i++) {
-                biquadFilterInit(
-                    &filter->notch[axis][motor][i], filter->minHz * i, filter->looptimeUs, filter->q, FILTER_NOTCH, 0.0f);
-            }
+    biquadNotchBankInit(&filter->notch, getMotorCount() * filter->harmonics);
+    for (int motor = 0; motor < getMotorCount(); motor++) {
+        for (int i = 0; i < filter->harmonics; i++) {
+            biquadNotchBankUpdate(
+                &filter->notch, motor * filter->harmonics + i, filter->minHz * i, filter->looptimeUs, filter->q, 0.0f);
         }
     }
 }
 
 void rpmFilterInit(const rpmFilterConfig_t *config)
 {
-    currentFilter = &filters[0];
-    currentMotor = currentHarmonic = currentFilterNumber = 0;
-
     numberRpmNotchFilters = 0;
     if (!motorConfig()->dev.useDshotTelemetry) {
         gyroFilter = NULL;
@@ -128,6 +122,7 @@ void rpmFilterInit(const rpmFilterConfig_t *config)
 
     pidLooptime = gyro.targetLooptime;
     if (config->rpm_filter_harmonics) {
+        biquadNotchTableInit(&notchTable, config->rpm_filter_q / 100.0f);
         gyroFilter = &filters[numberRpmNotchFilters++];
         rpmNotchFilterInit(gyroFilter, config, pidLooptime);
     } else {
@@ -139,29 +134,19 @@ void rpmFilterInit(const rpmFilterConfig_t *config)
     }
 
     erpmToHz = ERPM_PER_LSB / SECONDS_PER_MINUTE  / (motorConfig()->motorPoleCount / 2.0f);
-
-    const float loopIterationsPerUpdate = MIN_UPDATE_T / (pidLooptime * 1e-6f);
-    numberFilters = getMotorCount() * (filters[0].harmonics + filters[1].harmonics);
-    const float filtersPerLoopIteration = numberFilters / loopIterationsPerUpdate;
-    filterUpdatesPerIteration = rintf(filtersPerLoopIteration + 0.49f);
 }
 
-static float applyFilter(rpmNotchFilter_t *filter, const int axis, float value)
+static void applyFilter(rpmNotchFilter_t *filter, float *values)
 {
     if (filter == NULL) {
-        return value;
-    }
-    for (int motor = 0; motor < getMotorCount(); motor++) {
-        for (int i = 0; i < filter->harmonics; i++) {
-            value = biquadFilterApplyDF1Weighted(&filter->notch[axis][motor][i], value);
-        }
+        return;
     }
-    return value;
+    biquadNotchBankApply(&filter->notch, values);
 }
 
-float rpmFilterGyro(const int axis, float value)
+FAST_CODE void rpmFilterGyro(float *values)
 {
-    return applyFilter(gyroFilter, axis, value);
+    applyFilter(gyroFilter, values);
 }
 
 FAST_CODE_NOINLINE void rpmFilterUpdate(void)
@@ -174,51 +159,31 @@ FAST_CODE_NOINLINE void rpmFilterUpdate(void)
         motorFrequency[motor] = erpmToHz * filteredMotorErpm[motor];
     }
 
+    minMotorFrequency = 0.0f;
+
     if (gyroFilter == NULL) {
-        minMotorFrequency = 0.0f;
         return;
     }
 
-    for (int i = 0; i < filterUpdatesPerIteration; i++) {
-
-        float frequency = constrainf(
-            (currentHarmonic + 1) * motorFrequency[currentMotor], currentFilter->minHz, currentFilter->maxHz);
-        biquadFilter_t *template = &currentFilter->notch[0][currentMotor][currentHarmonic];
-        // uncomment below to debug filter stepping. Need to also comment out motor rpm DEBUG_SET above
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 0, harmonic); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 1, motor); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 2, currentFilter == &gyroFilter); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 3, frequency) */
-        
-        // fade out notch when approaching minHz (turn it off)
-        float weight = 1.0f;
-        if (frequency < currentFilter->minHz + currentFilter->fadeRangeHz) {
-            weight = (frequency - currentFilter->minHz) / currentFilter->fadeRangeHz;
-        }
+    // table lookups are cheap enough to retune every notch on every loop
+    for (int filterNumber = 0; filterNumber < numberRpmNotchFilters; filterNumber++) {
+        rpmNotchFilter_t *filter = &filters[filterNumber];
 
-        biquadFilterUpdate(
-            template, frequency, currentFilter->looptimeUs, currentFilter->q, FILTER_NOTCH, weight);
-
-        for (int axis = 1; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilter_t *clone = &currentFilter->notch[axis][currentMotor][currentHarmonic];
-            clone->b0 = template->b0;
-            clone->b1 = template->b1;
-            clone->b2 = template->b2;
-            clone->a1 = template->a1;
-            clone->a2 = template->a2;
-            clone->weight = template->weight;
-        }
-
-        if (++currentHarmonic == currentFilter->harmonics) {
-            currentHarmonic = 0;
-            if (++currentFilterNumber == numberRpmNotchFilters) {
-                currentFilterNumber = 0;
-                if (++currentMotor == getMotorCount()) {
-                    currentMotor = 0;
+        for (int motor = 0; motor < getMotorCount(); motor++) {
+            for (int harmonic = 0; harmonic < filter->harmonics; harmonic++) {
+                const float frequency = constrainf(
+                    (harmonic + 1) * motorFrequency[motor], filter->minHz, filter->maxHz);
+
+                // fade out notch when approaching minHz (turn it off)
+                float weight = 1.0f;
+                if (frequency < filter->minHz + filter->fadeRangeHz) {
+                    weight = (frequency - filter->minHz) / filter->fadeRangeHz;
                 }
-                minMotorFrequency = 0.0f;
+
+                // coefficients are shared by all axes, so a single update retunes the notch on X, Y and Z
+                biquadNotchBankUpdateFromTable(&filter->notch, motor * filter->harmonics + harmonic,
+                    &notchTable, frequency * filter->looptimeS, weight);
             }
-            currentFilter = &filters[currentFilterNumber];
         }
     }
 }
@@ -37,7 +37,7 @@ typedef struct rpmFilterConfig_s
 PG_DECLARE(rpmFilterConfig_t, rpmFilterConfig);
 
 void  rpmFilterInit(const rpmFilterConfig_t *config);
-float rpmFilterGyro(const int axis, float value);
+void  rpmFilterGyro(float *values);
 void  rpmFilterUpdate(void);
 bool isRpmFilterEnabled(void);
 float rpmMinMotorFrequency(void);
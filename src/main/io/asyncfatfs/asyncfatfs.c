@@ -469,6 +469,9 @@ typedef struct afatfs_t {
 
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
+    // The run of consecutive sectors handed to the card by the last flush, the flush completes with its last sector
+    uint8_t *cacheFlushBuffers[AFATFS_NUM_CACHE_SECTORS];
+    uint32_t cacheFlushLastSector;
 
     afatfsFile_t openFiles[AFATFS_MAX_OPEN_FILES];
 
@@ -681,7 +684,9 @@ static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_
     (void) operation;
     (void) callbackData;
 
-    afatfs.cacheFlushInProgress = false;
+    if (sectorIndex == afatfs.cacheFlushLastSector) {
+        afatfs.cacheFlushInProgress = false;
+    }
 
     for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
         /* Keep in mind that someone may have marked the sector as dirty after writing had already begun. In this case we must leave
@@ -705,11 +710,29 @@ static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_
 }
 
 /**
- * Attempt to flush the dirty cache entry with the given index to the SDcard.
+ * Find a sector in the cache which corresponds to the given physical sector index, or NULL if the sector isn't
+ * cached. Note that the cached sector could be in any state including completely empty.
+ */
+static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
+{
+    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
+            return &afatfs.cacheDescriptor[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Attempt to flush the dirty cache entry with the given index, and the dirty entries for the sectors that follow it, to
+ * the SDcard.
  */
 static void afatfs_cacheFlushSector(int cacheIndex)
 {
     afatfsCacheBlockDescriptor_t *cacheDescriptor = &afatfs.cacheDescriptor[cacheIndex];
+    int runIndexes[AFATFS_NUM_CACHE_SECTORS];
+    uint32_t runLength = 0;
 
 #ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
     if (cacheDescriptor->consecutiveEraseBlockCount) {
@@ -717,18 +740,40 @@ static void afatfs_cacheFlushSector(int cacheIndex)
     }
 #endif
 
-    switch (sdcard_writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
-        case SDCARD_OPERATION_IN_PROGRESS:
-            // The card will call us back later when the buffer transmission finishes
-            afatfs.cacheDirtyEntries--;
-            cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
-            afatfs.cacheFlushInProgress = true;
+    /*
+     * Sequential file data (like a log being appended to) leaves a run of dirty sectors behind in the cache when the
+     * card can't keep up, hand the whole run to the card so it can stream them in one multi-block write.
+     */
+    do {
+        runIndexes[runLength] = cacheIndex;
+        afatfs.cacheFlushBuffers[runLength] = afatfs_cacheSectorGetMemory(cacheIndex);
+        runLength++;
+
+        afatfsCacheBlockDescriptor_t *next = afatfs_findCacheSector(cacheDescriptor->sectorIndex + runLength);
+
+        if (!next || next->state != AFATFS_CACHE_STATE_DIRTY || next->locked) {
             break;
+        }
+
+        cacheIndex = next - afatfs.cacheDescriptor;
+    } while (runLength < AFATFS_NUM_CACHE_SECTORS);
+
+    const sdcardOperationStatus_e status = sdcard_writeBlocks(cacheDescriptor->sectorIndex, afatfs.cacheFlushBuffers, &runLength, afatfs_sdcardWriteComplete, 0);
 
+    switch (status) {
+        case SDCARD_OPERATION_IN_PROGRESS:
         case SDCARD_OPERATION_SUCCESS:
-            // Buffer is already transmitted
-            afatfs.cacheDirtyEntries--;
-            cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            for (uint32_t i = 0; i < runLength; i++) {
+                afatfs.cacheDirtyEntries--;
+
+                // The card will call us back later when the buffer transmission finishes
+                afatfs.cacheDescriptor[runIndexes[i]].state = status == SDCARD_OPERATION_SUCCESS ? AFATFS_CACHE_STATE_IN_SYNC : AFATFS_CACHE_STATE_WRITING;
+            }
+
+            if (status == SDCARD_OPERATION_IN_PROGRESS) {
+                afatfs.cacheFlushLastSector = cacheDescriptor->sectorIndex + runLength - 1;
+                afatfs.cacheFlushInProgress = true;
+            }
             break;
 
         case SDCARD_OPERATION_BUSY:
@@ -750,21 +795,6 @@ bool afatfs_sectorCacheInSync(void)
     return true;
 }
 
-/**
- * Find a sector in the cache which corresponds to the given physical sector index, or NULL if the sector isn't
- * cached. Note that the cached sector could be in any state including completely empty.
- */
-static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
-{
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
-            return &afatfs.cacheDescriptor[i];
-        }
-    }
-
-    return NULL;
-}
-
 /**
  * Find or allocate a cache sector for the given sector index on disk. Returns a block which matches one of these
  * conditions (in descending order of preference):
@@ -3719,6 +3749,11 @@ bool afatfs_destroy(bool dirty)
 /**
  * Get a pessimistic estimate of the amount of buffer space that we have available to write to immediately.
  */
+uint32_t afatfs_getBufferSize(void)
+{
+    return AFATFS_SECTOR_SIZE * AFATFS_NUM_CACHE_SECTORS;
+}
+
 uint32_t afatfs_getFreeBufferSpace(void)
 {
     uint32_t result = 0;
@@ -87,6 +87,7 @@ void afatfs_init(void);
 bool afatfs_destroy(bool dirty);
 void afatfs_poll(void);
 
+uint32_t afatfs_getBufferSize(void);
 uint32_t afatfs_getFreeBufferSpace(void);
 uint32_t afatfs_getContiguousFreeSpace(void);
 bool afatfs_isFull(void);
@@ -39,8 +39,13 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "common/maths.h"
 #include "common/printf.h"
+#include "common/utils.h"
 #include "drivers/flash.h"
+#include "drivers/time.h"
+
+#include "pg/flash.h"
 
 #include "io/flashfs.h"
 
@@ -60,8 +65,10 @@ static DMA_DATA_ZERO_INIT uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  * The tail is advanced once a write is complete up to the location behind head. The tail is advanced
  * by a callback from the FLASH write routine. This prevents data being overwritten whilst a write is in progress.
  */
-static uint8_t bufferHead = 0;
-static volatile uint8_t bufferTail = 0;
+static uint16_t bufferHead = 0;
+static volatile uint16_t bufferTail = 0;
+
+STATIC_ASSERT(FLASHFS_WRITE_BUFFER_SIZE <= UINT16_MAX, flashfs_write_buffer_too_large);
 
 /* Track if there is new data to write. Until the contents of the buffer have been completely
  * written flashfsFlushAsync() will be repeatedly called. The tail pointer is only updated
@@ -87,6 +94,47 @@ uint32_t checkFlashErrors = 0;
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+static flashfsStats_t flashfsStats;
+// When the current stall started, valid while stalled is set
+static timeUs_t stallStartUs;
+static bool stalled;
+
+/*
+ * Erase ahead mode: instead of erasing the volume up front, sectors are erased in the background just ahead of the
+ * write position. Everything between the tail and eraseFrontier is known to be erased, sectors from eraseFrontier
+ * onwards may still hold old data.
+ */
+static bool eraseAhead;
+static uint32_t eraseFrontier;
+static timeMs_t lastWriteMs;
+
+#ifdef USE_FLASHFS_INDEX
+/*
+ * The log index lives in its own partition after the volume and holds one record per page, appended whenever a log is
+ * opened or closed. The start of the free space and the log boundaries can then be found by reading a record per log
+ * instead of searching the volume, which takes seconds on large NAND parts.
+ */
+#define FLASHFS_INDEX_MAGIC 0x58444946 // "FIDX"
+
+typedef enum {
+    FLASHFS_INDEX_LOG_START = 1,
+    FLASHFS_INDEX_LOG_END,
+} flashfsIndexRecordType_e;
+
+typedef struct flashfsIndexRecord_s {
+    uint32_t magic;
+    uint32_t type;
+    uint32_t address;
+    uint32_t check; // ~(type ^ address), catches a record torn by a power loss
+} flashfsIndexRecord_t;
+
+static uint32_t indexAddress;
+static uint16_t indexCapacity;
+// Records in the index, indexCapacity once it is full or could not be read, in which case it is ignored until erased
+static uint16_t indexCount;
+static flashfsIndexRecord_t indexLast;
+#endif
+
 static void flashfsClearBuffer(void)
 {
     bufferTail = bufferHead = 0;
@@ -104,9 +152,35 @@ static void flashfsSetTailAddress(uint32_t address)
 
 void flashfsEraseCompletely(void)
 {
+#ifdef USE_FLASHFS_INDEX
+    const flashPartition_t *indexPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS_INDEX);
+    const int indexPartitionCount = indexPartition ? 1 : 0;
+    const int indexSectorCount = indexPartition ? FLASH_PARTITION_SECTOR_COUNT(indexPartition) : 0;
+
+    indexCount = 0;
+#else
+    const int indexPartitionCount = 0;
+    const int indexSectorCount = 0;
+#endif
+
+    if (eraseAhead) {
+        // Old data is erased in the background, or just in time ahead of new writes
+        flashfsClearBuffer();
+        flashfsSetTailAddress(0);
+        eraseFrontier = 0;
+
+#ifdef USE_FLASHFS_INDEX
+        if (indexPartition) {
+            flashEraseSector(indexAddress);
+        }
+#endif
+
+        return;
+    }
+
     if (flashGeometry->sectors > 0 && flashPartitionCount() > 0) {
-        // if there's a single FLASHFS partition and it uses the entire flash then do a full erase
-        const bool doFullErase = (flashPartitionCount() == 1) && (FLASH_PARTITION_SECTOR_COUNT(flashPartition) == flashGeometry->sectors);
+        // if there's a single FLASHFS partition (and its index) and it uses the entire flash then do a full erase
+        const bool doFullErase = (flashPartitionCount() == 1 + indexPartitionCount) && (FLASH_PARTITION_SECTOR_COUNT(flashPartition) + indexSectorCount == flashGeometry->sectors);
         if (doFullErase) {
             flashEraseCompletely();
         } else {
@@ -121,6 +195,12 @@ void flashfsEraseCompletely(void)
                 uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
                 flashEraseSector(sectorAddress);
             }
+
+#ifdef USE_FLASHFS_INDEX
+            if (indexPartition) {
+                flashEraseSector(indexAddress);
+            }
+#endif
         }
     }
 
@@ -243,6 +323,12 @@ void flashfsWriteCallback(uint32_t arg)
     dataWritten = true;
 }
 
+static void flashfsEraseNextSector(void)
+{
+    flashEraseSector(eraseFrontier);
+    eraseFrontier += flashGeometry->sectorSize;
+}
+
 static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, bool sync)
 {
     uint32_t bytesWritten;
@@ -254,15 +340,39 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
         while (!flashIsReady());
     } else {
         if (!flashIsReady()) {
+            // Data keeps accumulating in the buffer while the device finishes programming the previous page
+            if (!stalled) {
+                stalled = true;
+                stallStartUs = micros();
+                flashfsStats.stallCount++;
+                DEBUG_SET(DEBUG_FLASHFS, 3, flashfsStats.stallCount);
+            }
             return 0;
         }
     }
 
+    if (stalled) {
+        const timeDelta_t stallUs = cmpTimeUs(micros(), stallStartUs);
+        flashfsStats.stallTimeUs += stallUs;
+        flashfsStats.stallTimeMaxUs = MAX(flashfsStats.stallTimeMaxUs, (uint32_t)stallUs);
+        DEBUG_SET(DEBUG_FLASHFS, 1, MIN(stallUs, INT16_MAX));
+        stalled = false;
+    }
+
     // Are we at EOF already? Abort.
     if (flashfsIsEOF()) {
         return 0;
     }
 
+    // A single write never crosses a page, and so never a sector, boundary
+    if (eraseAhead && tailAddress >= eraseFrontier) {
+        flashfsEraseNextSector();
+        if (!sync) {
+            return 0;
+        }
+        while (!flashIsReady());
+    }
+
 #ifdef CHECK_FLASH
     checkFlashPtr = tailAddress;
 #endif
@@ -414,19 +524,90 @@ void flashfsSeekAbs(uint32_t offset)
     flashfsSetTailAddress(offset);
 }
 
+/*
+ * Background part of erase ahead, run from a low priority task. While data is being logged only the sectors right
+ * ahead of the tail are erased, as the device is busy and cannot accept writes during an erase. Otherwise the rest
+ * of the old data is erased one sector at a time whenever the device is idle.
+ */
+void flashfsEraseAheadUpdate(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    if (!eraseAhead || eraseFrontier >= flashfsSize) {
+        return;
+    }
+
+    const bool logging = !flashfsBufferIsEmpty() || cmp32(millis(), lastWriteMs) < FLASHFS_ERASE_AHEAD_IDLE_MS;
+    if (logging && eraseFrontier >= tailAddress + FLASHFS_ERASE_AHEAD_SECTORS * flashGeometry->sectorSize) {
+        return;
+    }
+
+    if (flashIsReady()) {
+        flashfsEraseNextSector();
+    }
+}
+
+bool flashfsEraseAheadIsComplete(void)
+{
+    return !eraseAhead || eraseFrontier >= flashfsSize;
+}
+
+static void flashfsUpdateBufferStats(void)
+{
+    const uint16_t used = flashfsTransmitBufferUsed();
+
+    flashfsStats.bufferUsedMax = MAX(flashfsStats.bufferUsedMax, used);
+    DEBUG_SET(DEBUG_FLASHFS, 0, used);
+}
+
+static void flashfsDropData(unsigned int len)
+{
+    flashfsStats.bytesDropped += len;
+    DEBUG_SET(DEBUG_FLASHFS, 2, MIN(flashfsStats.bytesDropped, (uint32_t)INT16_MAX));
+}
+
 /**
- * Write the given byte asynchronously to the flash. If the buffer overflows, data is silently discarded.
+ * Copy as much of the given data into the write buffer as fits.
+ *
+ * The flash may be reading out of the buffer at the tail by DMA at the same time, so only the free space ahead of
+ * the head is touched. Returns the number of bytes buffered.
  */
-void flashfsWriteByte(uint8_t byte)
+static unsigned int flashfsBufferData(const uint8_t *data, unsigned int len)
 {
+    len = MIN(len, flashfsGetWriteBufferFreeSpace());
+
 #ifdef CHECK_FLASH
-    byte = checkFlashWrite++;
+    for (unsigned int i = 0; i < len; i++) {
+        flashWriteBuffer[bufferHead++] = checkFlashWrite++;
+        if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
+            bufferHead = 0;
+        }
+    }
+#else
+    // At most two copies, the second one when the data wraps around the end of the buffer
+    const unsigned int firstLen = MIN(len, (unsigned int)(FLASHFS_WRITE_BUFFER_SIZE - bufferHead));
+    memcpy(flashWriteBuffer + bufferHead, data, firstLen);
+    memcpy(flashWriteBuffer, data + firstLen, len - firstLen);
+
+    bufferHead += len;
+    if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
+        bufferHead -= FLASHFS_WRITE_BUFFER_SIZE;
+    }
 #endif
 
-    flashWriteBuffer[bufferHead++] = byte;
+    flashfsUpdateBufferStats();
+    lastWriteMs = millis();
 
-    if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
-        bufferHead = 0;
+    return len;
+}
+
+/**
+ * Write the given byte asynchronously to the flash. If the buffer overflows, data is silently discarded.
+ */
+void flashfsWriteByte(uint8_t byte)
+{
+    if (flashfsBufferData(&byte, 1) == 0) {
+        flashfsDropData(1);
     }
 
     if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
@@ -447,9 +628,25 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
     int bufCount;
     uint32_t totalBufSize;
 
-    // Buffer up the data the user supplied instead of writing it right away
-    for (unsigned int i = 0; i < len; i++) {
-        flashfsWriteByte(data[i]);
+    /*
+     * Buffer up the data the user supplied instead of writing it right away. The buffer is filled in bulk while the
+     * flash programs the previously flushed page, rather than polling the device after every byte.
+     */
+    while (len > 0) {
+        const unsigned int buffered = flashfsBufferData(data, len);
+        data += buffered;
+        len -= buffered;
+
+        if (len == 0 || !sync || flashfsIsEOF()) {
+            break;
+        }
+
+        // Make room for the rest
+        bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+        flashfsWriteBuffers(buffers, bufferSizes, bufCount, true);
+    }
+    if (len > 0) {
+        flashfsDropData(len);
     }
 
     // There could be two dirty buffers to write out already:
@@ -488,10 +685,49 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
     return bytesRead;
 }
 
+enum {
+    /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
+     * at the end of the last written data. But smaller blocksizes will require more searching.
+     */
+    FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
+
+    /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
+    FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
+    FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
+};
+
+STATIC_ASSERT(FREE_BLOCK_SIZE >= FLASH_MAX_PAGE_SIZE, FREE_BLOCK_SIZE_too_small);
+
 /**
- * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ * Check whether the block at the given address appears to be erased. Returns false if the flash could not be read.
  */
-int flashfsIdentifyStartOfFreeSpace(void)
+static bool flashfsTestBlockErased(uint32_t address, bool *blockErased)
+{
+    STATIC_DMA_DATA_AUTO union {
+        uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
+        uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
+    } testBuffer;
+
+    if (flashReadBytes(address, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        return false;
+    }
+
+    // Checking the buffer 4 bytes at a time like this is probably faster than byte-by-byte, but I didn't benchmark it :)
+    *blockErased = true;
+    for (int i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
+        if (testBuffer.ints[i] != 0xFFFFFFFF) {
+            *blockErased = false;
+            break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Binary search [start...end) for the first erased block, where every block after it is expected to be erased too.
+ */
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t start, uint32_t end)
 {
     /* Find the start of the free space on the device by examining the beginning of blocks with a binary search,
      * looking for ones that appear to be erased. We can achieve this with good accuracy because an erased block
@@ -502,48 +738,20 @@ int flashfsIdentifyStartOfFreeSpace(void)
      * bandwidth and block more often.
      */
 
-    enum {
-        /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
-         * at the end of the last written data. But smaller blocksizes will require more searching.
-         */
-        FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
-
-        /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
-        FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
-        FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
-    };
-
-    STATIC_ASSERT(FREE_BLOCK_SIZE >= FLASH_MAX_PAGE_SIZE, FREE_BLOCK_SIZE_too_small);
-
-    STATIC_DMA_DATA_AUTO union {
-        uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
-        uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
-    } testBuffer;
-
-    int left = 0; // Smallest block index in the search region
-    int right = flashfsSize / FREE_BLOCK_SIZE; // One past the largest block index in the search region
+    int left = start / FREE_BLOCK_SIZE; // Smallest block index in the search region
+    int right = end / FREE_BLOCK_SIZE; // One past the largest block index in the search region
     int mid;
     int result = right;
-    int i;
     bool blockErased;
 
     while (left < right) {
         mid = (left + right) / 2;
 
-        if (flashReadBytes(mid * FREE_BLOCK_SIZE, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        if (!flashfsTestBlockErased(mid * FREE_BLOCK_SIZE, &blockErased)) {
             // Unexpected timeout from flash, so bail early (reporting the device fuller than it really is)
             break;
         }
 
-        // Checking the buffer 4 bytes at a time like this is probably faster than byte-by-byte, but I didn't benchmark it :)
-        blockErased = true;
-        for (i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
-            if (testBuffer.ints[i] != 0xFFFFFFFF) {
-                blockErased = false;
-                break;
-            }
-        }
-
         if (blockErased) {
             /* This erased block might be the leftmost erased block in the volume, but we'll need to continue the
              * search leftwards to find out:
@@ -559,6 +767,196 @@ int flashfsIdentifyStartOfFreeSpace(void)
     return result * FREE_BLOCK_SIZE;
 }
 
+/**
+ * Return the address of the first sector at or after start whose first block is erased (or not erased), or the size
+ * of the volume if there is none. A read failure counts as not erased.
+ */
+static uint32_t flashfsScanSectors(uint32_t start, bool erased)
+{
+    const uint32_t sectorSize = flashGeometry->sectorSize;
+
+    for (uint32_t address = start; address < flashfsSize; address += sectorSize) {
+        bool blockErased = false;
+
+        flashfsTestBlockErased(address, &blockErased);
+        if (blockErased == erased) {
+            return address;
+        }
+    }
+
+    return flashfsSize;
+}
+
+/**
+ * Search for the start of the free space at or after the given address, which must lie within the written logs.
+ */
+static uint32_t flashfsSearchStartOfFreeSpace(uint32_t start)
+{
+    if (!eraseAhead) {
+        return flashfsFindStartOfFreeSpace(start, flashfsSize);
+    }
+
+    /*
+     * With erase ahead the volume holds the current logs, then erased sectors, then possibly older data that has not
+     * been erased yet, so a binary search over the whole volume does not apply. Sectors are erased whole and written
+     * in order, so scan the sector starts for the first erased one and search for the exact start of the free space
+     * in the sector before it.
+     */
+    const uint32_t startSector = start - start % flashGeometry->sectorSize;
+    const uint32_t firstErasedSector = flashfsScanSectors(startSector, true);
+    if (firstErasedSector == startSector) {
+        return startSector;
+    }
+
+    return flashfsFindStartOfFreeSpace(firstErasedSector - flashGeometry->sectorSize, firstErasedSector);
+}
+
+#ifdef USE_FLASHFS_INDEX
+static bool flashfsIndexReadRecord(int index, flashfsIndexRecord_t *record)
+{
+    const uint32_t address = indexAddress + index * flashGeometry->pageSize;
+
+    return flashReadBytes(address, (uint8_t *)record, sizeof(*record)) == sizeof(*record);
+}
+
+static void flashfsIndexLoad(void)
+{
+    const flashPartition_t *indexPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS_INDEX);
+
+    indexCapacity = 0;
+    indexCount = 0;
+
+    if (!indexPartition) {
+        return;
+    }
+
+    indexAddress = indexPartition->startSector * flashGeometry->sectorSize;
+    indexCapacity = MIN(FLASH_PARTITION_SECTOR_COUNT(indexPartition) * flashGeometry->pagesPerSector, UINT16_MAX);
+
+    flashfsIndexRecord_t record;
+    while (indexCount < indexCapacity) {
+        if (!flashfsIndexReadRecord(indexCount, &record)) {
+            indexCount = indexCapacity;
+            break;
+        }
+
+        if (record.magic == 0xFFFFFFFF) {
+            // First unused record
+            break;
+        }
+
+        if (record.magic != FLASHFS_INDEX_MAGIC || record.check != ~(record.type ^ record.address)) {
+            indexCount = indexCapacity;
+            break;
+        }
+
+        indexLast = record;
+        indexCount++;
+    }
+}
+
+static bool flashfsIndexIsComplete(void)
+{
+    return indexCount < indexCapacity;
+}
+
+/**
+ * Append a record of the current tail address to the index, waiting for it to be written.
+ */
+static void flashfsIndexAppend(flashfsIndexRecordType_e type)
+{
+    STATIC_DMA_DATA_AUTO flashfsIndexRecord_t record;
+
+    if (!flashfsIndexIsComplete()) {
+        return;
+    }
+
+    record.magic = FLASHFS_INDEX_MAGIC;
+    record.type = type;
+    record.address = tailAddress;
+    record.check = ~(record.type ^ record.address);
+
+    while (!flashIsReady());
+
+    flashPageProgram(indexAddress + indexCount * flashGeometry->pageSize, (const uint8_t *)&record, sizeof(record), NULL);
+    flashFlush();
+
+    while (!flashIsReady());
+
+    indexLast = record;
+    indexCount++;
+}
+
+/**
+ * Fill in up to maxCount logs from the index, given the end of the used space. Returns -1 if the index does not cover
+ * the whole volume, in which case the logs must be found by reading the volume.
+ */
+int flashfsIndexGetLogs(flashfsLog_t *logs, int maxCount, uint32_t usedSpace)
+{
+    if (!flashfsIndexIsComplete() || (indexCount == 0 && usedSpace > 0)) {
+        return -1;
+    }
+
+    int logCount = 0;
+    bool logOpen = false;
+    uint32_t logStart = 0;
+
+    for (int index = 0; index < indexCount; index++) {
+        flashfsIndexRecord_t record;
+
+        if (!flashfsIndexReadRecord(index, &record) || (index == 0 && record.address != 0)) {
+            // Logs written before the index was
+            return -1;
+        }
+
+        // A log left open by a power loss ends where the next one starts
+        if (logOpen && record.address > logStart && logCount < maxCount) {
+            logs[logCount].start = logStart;
+            logs[logCount].size = record.address - logStart;
+            logCount++;
+        }
+
+        logOpen = record.type == FLASHFS_INDEX_LOG_START;
+        logStart = record.address;
+    }
+
+    if (logOpen && usedSpace > logStart && logCount < maxCount) {
+        logs[logCount].start = logStart;
+        logs[logCount].size = usedSpace - logStart;
+        logCount++;
+    }
+
+    return logCount;
+}
+
+int flashfsIndexGetRecordCount(void)
+{
+    return flashfsIndexIsComplete() ? indexCount : -1;
+}
+#endif
+
+/**
+ * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ */
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+    uint32_t searchStart = 0;
+
+#ifdef USE_FLASHFS_INDEX
+    if (flashfsIndexIsComplete() && indexCount > 0) {
+        // The free space starts right after a closed log, or somewhere after the start of one left open
+        searchStart = indexLast.address;
+
+        bool blockErased;
+        if (indexLast.type == FLASHFS_INDEX_LOG_END && flashfsTestBlockErased(searchStart, &blockErased) && blockErased) {
+            return searchStart;
+        }
+    }
+#endif
+
+    return flashfsSearchStartOfFreeSpace(searchStart);
+}
+
 /**
  * Returns true if the file pointer is at the end of the device.
  */
@@ -567,7 +965,7 @@ bool flashfsIsEOF(void)
     return tailAddress >= flashfsSize;
 }
 
-void flashfsClose(void)
+static void flashfsFinishPage(void)
 {
     switch(flashGeometry->flashType) {
     case FLASH_TYPE_NOR:
@@ -584,6 +982,31 @@ void flashfsClose(void)
     }
 }
 
+/**
+ * Call before writing a new log, after which the log must be ended with flashfsClose().
+ */
+void flashfsOpen(void)
+{
+#ifdef USE_FLASHFS_INDEX
+    flashfsFlushSync();
+    flashfsFinishPage();
+    flashfsIndexAppend(FLASHFS_INDEX_LOG_START);
+#endif
+}
+
+void flashfsClose(void)
+{
+#ifdef USE_FLASHFS_INDEX
+    flashfsFlushSync();
+#endif
+
+    flashfsFinishPage();
+
+#ifdef USE_FLASHFS_INDEX
+    flashfsIndexAppend(FLASHFS_INDEX_LOG_END);
+#endif
+}
+
 /**
  * Call after initializing the flash chip in order to set up the filesystem.
  */
@@ -599,9 +1022,22 @@ void flashfsInit(void)
     }
 
     flashfsSize = FLASH_PARTITION_SECTOR_COUNT(flashPartition) * flashGeometry->sectorSize;
+    eraseAhead = flashConfig()->eraseAhead;
+
+#ifdef USE_FLASHFS_INDEX
+    flashfsIndexLoad();
+#endif
 
     // Start the file pointer off at the beginning of free space so caller can start writing immediately
-    flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
+    const uint32_t startOfFreeSpace = flashfsIdentifyStartOfFreeSpace();
+    flashfsSeekAbs(startOfFreeSpace);
+
+    if (eraseAhead) {
+        // Old data may follow the erased sectors left ahead of the last log
+        const uint32_t sectorSize = flashGeometry->sectorSize;
+        const uint32_t nextSector = (startOfFreeSpace + sectorSize - 1) / sectorSize * sectorSize;
+        eraseFrontier = flashfsScanSectors(nextSector, false);
+    }
 }
 
 #ifdef USE_FLASH_TOOLS
@@ -644,3 +1080,13 @@ bool flashfsVerifyEntireFlash(void)
     return verificationFailures == 0;
 }
 #endif // USE_FLASH_TOOLS
+
+const flashfsStats_t *flashfsGetStats(void)
+{
+    return &flashfsStats;
+}
+
+void flashfsResetStats(void)
+{
+    memset(&flashfsStats, 0, sizeof(flashfsStats));
+}
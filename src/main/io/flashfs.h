@@ -20,12 +20,44 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/time.h"
+
+#ifndef FLASHFS_WRITE_BUFFER_SIZE
+#ifdef USE_FLASH_W25N01G
+// Keep accepting data while a whole 2KB page is programmed (tPP up to 700us) instead of dropping it
+#define FLASHFS_WRITE_BUFFER_SIZE 1024
+#else
 #define FLASHFS_WRITE_BUFFER_SIZE 128
+#endif
+#endif
 #define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
 
 // Automatically trigger a flush when this much data is in the buffer
 #define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
 
+// In erase ahead mode, sectors kept erased ahead of the write position while logging
+#define FLASHFS_ERASE_AHEAD_SECTORS 2
+// and how long after the last write the rest of the volume may be erased
+#define FLASHFS_ERASE_AHEAD_IDLE_MS 1000
+
+typedef struct flashfsLog_s {
+    uint32_t start;
+    uint32_t size;
+} flashfsLog_t;
+
+typedef struct flashfsStats_s {
+    uint32_t stallCount;        // Flushes that found the device still busy with the previous program
+    uint32_t stallTimeUs;       // Total time buffered data waited for the device
+    uint32_t stallTimeMaxUs;    // Longest single wait
+    uint32_t bytesDropped;      // Bytes discarded because the write buffer was full
+    uint16_t bufferUsedMax;     // High water mark of the write buffer
+} flashfsStats_t;
+
 void flashfsEraseCompletely(void);
 void flashfsEraseRange(uint32_t start, uint32_t end);
 
@@ -47,6 +79,7 @@ int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
+void flashfsOpen(void);
 void flashfsClose(void);
 void flashfsInit(void);
 bool flashfsIsSupported(void);
@@ -56,3 +89,12 @@ bool flashfsIsEOF(void);
 
 bool flashfsVerifyEntireFlash(void);
 
+int flashfsIndexGetLogs(flashfsLog_t *logs, int maxCount, uint32_t usedSpace);
+int flashfsIndexGetRecordCount(void);
+
+void flashfsEraseAheadUpdate(timeUs_t currentTimeUs);
+bool flashfsEraseAheadIsComplete(void);
+
+const flashfsStats_t *flashfsGetStats(void);
+void flashfsResetStats(void);
+
@@ -26,6 +26,7 @@
 #include "emfat.h"
 #include "emfat_file.h"
 
+#include "common/maths.h"
 #include "common/printf.h"
 #include "common/strtol.h"
 #include "common/time.h"
@@ -307,20 +308,71 @@ static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uin
     entry->cma_time[2] = entry->cma_time[0];
 }
 
+static const char logHeader[] = "H Product:Blackbox";
+
+// Find the "Log start datetime" entry, example encoding "H Log start datetime:2019-08-15T13:18:22.199+00:00"
+static void emfat_find_log_time(emfat_entry_t *entry, uint8_t *buffer, int logOffset, int flashfsUsedSpace)
+{
+    const char *timeHeader = "H Log start datetime:";
+    const int lenTimeHeader = strlen(timeHeader);
+    int timeHeaderMatched = 0;
+    int buffOffset = strlen(logHeader);
+    int hdrOffset = logOffset;
+
+    // Set the default timestamp for this log entry in case the timestamp is not found
+    entry->cma_time[0] = cmaTime;
+
+    // Search for the timestamp record
+    while (true) {
+        if (buffer[buffOffset++] == timeHeader[timeHeaderMatched]) {
+            // This matches the header we're looking for so far
+            if (++timeHeaderMatched == lenTimeHeader) {
+                // Complete match so read date/time into buffer
+                flashfsReadAbs(hdrOffset + buffOffset, buffer, HDR_BUF_SIZE);
+
+                // Extract the time values to create the CMA time
+                char *nextToken = (char *)buffer;
+                int year = strtoul(nextToken, &nextToken, 10);
+                int month = strtoul(++nextToken, &nextToken, 10);
+                int day = strtoul(++nextToken, &nextToken, 10);
+                int hour = strtoul(++nextToken, &nextToken, 10);
+                int min = strtoul(++nextToken, &nextToken, 10);
+                int sec = strtoul(++nextToken, NULL, 10);
+
+                // Set the file creation time
+                if (year) {
+                    entry->cma_time[0] = EMFAT_ENCODE_CMA_TIME(day, month, year, hour, min, sec);
+                }
+
+                break;
+            }
+        } else {
+            timeHeaderMatched = 0;
+        }
+
+        if (buffOffset == HDR_BUF_SIZE) {
+            // Read the next portion of the header
+            hdrOffset += HDR_BUF_SIZE;
+
+            // Check for flash overflow
+            if (hdrOffset > flashfsUsedSpace) {
+                break;
+            }
+
+            flashfsReadAbs(hdrOffset, buffer, HDR_BUF_SIZE);
+            buffOffset = 0;
+        }
+    }
+}
+
 static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpace)
 {
     static uint8_t buffer[HDR_BUF_SIZE];
     int lastOffset = 0;
     int currOffset = 0;
-    int buffOffset;
-    int hdrOffset;
     int fileNumber = 0;
     int logCount = 0;
-    char *logHeader = "H Product:Blackbox";
-    int lenLogHeader = strlen(logHeader);
-    char *timeHeader = "H Log start datetime:";
-    int lenTimeHeader = strlen(timeHeader);
-    int timeHeaderMatched = 0;
+    const int lenLogHeader = strlen(logHeader);
 
     for ( ; currOffset < flashfsUsedSpace ; currOffset += 2048) { // XXX 2048 = FREE_BLOCK_SIZE in io/flashfs.c
 
@@ -341,55 +393,7 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpa
             logCount++;
         }
 
-        // Find the "Log start datetime" entry, example encoding "H Log start datetime:2019-08-15T13:18:22.199+00:00"
-
-        buffOffset = lenLogHeader;
-        hdrOffset = currOffset;
-
-        // Set the default timestamp for this log entry in case the timestamp is not found
-        entry->cma_time[0] = cmaTime;
-
-        // Search for the timestamp record
-        while (true) {
-            if (buffer[buffOffset++] == timeHeader[timeHeaderMatched]) {
-                // This matches the header we're looking for so far
-                if (++timeHeaderMatched == lenTimeHeader) {
-                    // Complete match so read date/time into buffer
-                    flashfsReadAbs(hdrOffset + buffOffset, buffer, HDR_BUF_SIZE);
-
-                    // Extract the time values to create the CMA time
-                    char *nextToken = (char *)buffer;
-                    int year = strtoul(nextToken, &nextToken, 10);
-                    int month = strtoul(++nextToken, &nextToken, 10);
-                    int day = strtoul(++nextToken, &nextToken, 10);
-                    int hour = strtoul(++nextToken, &nextToken, 10);
-                    int min = strtoul(++nextToken, &nextToken, 10);
-                    int sec = strtoul(++nextToken, NULL, 10);
-
-                    // Set the file creation time
-                    if (year) {
-                        entry->cma_time[0] = EMFAT_ENCODE_CMA_TIME(day, month, year, hour, min, sec);
-                    }
-
-                    break;
-                }
-            } else {
-                timeHeaderMatched = 0;
-            }
-
-            if (buffOffset == HDR_BUF_SIZE) {
-                // Read the next portion of the header
-                hdrOffset += HDR_BUF_SIZE;
-
-                // Check for flash overflow
-                if (hdrOffset > flashfsUsedSpace) {
-                    break;
-                }
-
-                flashfsReadAbs(hdrOffset, buffer, HDR_BUF_SIZE);
-                buffOffset = 0;
-            }
-        }
+        emfat_find_log_time(entry, buffer, currOffset, flashfsUsedSpace);
 
         if (fileNumber == maxCount) {
             break;
@@ -406,6 +410,28 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpa
 
     return logCount;
 }
+
+#ifdef USE_FLASHFS_INDEX
+// Returns -1 if the index does not cover the flash and it has to be searched instead
+static int emfat_find_indexed_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpace)
+{
+    static uint8_t buffer[HDR_BUF_SIZE];
+    static flashfsLog_t logs[EMFAT_MAX_LOG_ENTRY];
+
+    const int logCount = flashfsIndexGetLogs(logs, MIN(maxCount, EMFAT_MAX_LOG_ENTRY), flashfsUsedSpace);
+
+    for (int i = 0; i < logCount; i++) {
+        mscSetActive();
+        mscActivityLed();
+
+        flashfsReadAbs(logs[i].start, buffer, HDR_BUF_SIZE);
+        emfat_find_log_time(entry, buffer, logs[i].start, flashfsUsedSpace);
+        emfat_add_log(entry++, i, logs[i].start, logs[i].size);
+    }
+
+    return logCount;
+}
+#endif
 #endif  // USE_FLASHFS
 
 void emfat_init_files(void)
@@ -438,7 +464,13 @@ void emfat_init_files(void)
     flashfsUsedSpace = flashfsIdentifyStartOfFreeSpace();
 
     // Detect and create entries for each individual log
-    const int logCount = emfat_find_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY, flashfsUsedSpace);
+    int logCount = -1;
+#ifdef USE_FLASHFS_INDEX
+    logCount = emfat_find_indexed_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY, flashfsUsedSpace);
+#endif
+    if (logCount < 0) {
+        logCount = emfat_find_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY, flashfsUsedSpace);
+    }
 
     entryIndex += logCount;
 
@@ -61,6 +61,7 @@
 #include "drivers/flash.h"
 #include "drivers/io.h"
 #include "drivers/motor.h"
+#include "drivers/motor_latency.h"
 #include "drivers/osd.h"
 #include "drivers/pwm_output.h"
 #include "drivers/sdcard.h"
@@ -132,6 +133,7 @@
 #include "rx/msp.h"
 
 #include "scheduler/scheduler.h"
+#include "scheduler/scheduler_trace.h"
 
 #include "sensors/acceleration.h"
 #include "sensors/barometer.h"
@@ -1716,6 +1718,48 @@ static bool mspProcessOutCommand(int16_t cmdMSP, sbuf_t *dst)
 #endif
         break;
 
+#ifdef USE_BLACKBOX
+    case MSP2_GET_BLACKBOX_STATS:
+        {
+            const blackboxStats_t *stats = blackboxGetStats();
+
+            sbufWriteU8(dst, BLACKBOX_STATS_FRAME_COUNT);
+            for (int i = 0; i < BLACKBOX_STATS_FRAME_COUNT; i++) {
+                sbufWriteU32(dst, stats->framesLogged[i]);
+                sbufWriteU32(dst, stats->framesDropped[i]);
+            }
+            sbufWriteU32(dst, stats->bytesPerSecond);
+            sbufWriteU8(dst, stats->bufferUsedMaxPercent);
+            sbufWriteU8(dst, BLACKBOX_STATS_FLUSH_BUCKET_COUNT);
+            sbufWriteU16(dst, BLACKBOX_STATS_FLUSH_BUCKET_MIN_US);
+            for (int i = 0; i < BLACKBOX_STATS_FLUSH_BUCKET_COUNT; i++) {
+                sbufWriteU32(dst, stats->flushLatency[i]);
+            }
+        }
+        break;
+#endif
+
+#ifdef USE_MOTOR_LATENCY_STATS
+    case MSP2_GET_MOTOR_LATENCY:
+        {
+            const motorLatencyStats_t *stats = motorLatencyGetStats();
+
+            sbufWriteU8(dst, motorLatencyIsEnabled());
+            sbufWriteU32(dst, stats->sampleCount);
+            sbufWriteU32(dst, stats->skippedUpdates);
+            // latencies in tenths of a microsecond
+            sbufWriteU32(dst, stats->minUs10);
+            sbufWriteU32(dst, stats->maxUs10);
+            sbufWriteU32(dst, motorLatencyAverageUs10());
+            sbufWriteU8(dst, MOTOR_LATENCY_BUCKET_COUNT);
+            sbufWriteU16(dst, MOTOR_LATENCY_BUCKET_WIDTH_US);
+            for (int i = 0; i < MOTOR_LATENCY_BUCKET_COUNT; i++) {
+                sbufWriteU32(dst, stats->histogram[i]);
+            }
+        }
+        break;
+#endif
+
     case MSP_SDCARD_SUMMARY:
         serializeSDCardSummaryReply(dst);
         break;
@@ -2282,6 +2326,30 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_
         }
         break;
 
+#ifdef USE_SCHEDULER_TRACE
+    case MSP2_GET_SCHEDULER_TRACE:
+        {
+            // Paged read of the task trace ring, oldest entry first. Reading the first page stops the trace
+            const unsigned start = sbufBytesRemaining(src) >= 2 ? sbufReadU16(src) : 0;
+            if (start == 0) {
+                schedulerTraceStop();
+            }
+            sbufWriteU16(dst, schedulerTraceCount());
+            sbufWriteU16(dst, start);
+            sbufWriteU32(dst, clockMicrosToCycles(1000));   // cycles per ms, to convert the cycle counts to time
+
+            schedulerTraceEntry_t entry;
+            for (unsigned i = start; sbufBytesRemaining(dst) > (int)sizeof(entry) && schedulerTraceGet(i, &entry); i++) {
+                sbufWriteU32(dst, entry.startCycles);
+                sbufWriteU32(dst, entry.endCycles);
+                sbufWriteU16(dst, entry.checkCycles);
+                sbufWriteU8(dst, entry.taskId);
+                sbufWriteU8(dst, entry.flags);
+            }
+        }
+        break;
+#endif
+
 #ifdef USE_VTX_TABLE
     case MSP_VTXTABLE_BAND:
         {
@@ -24,3 +24,6 @@
 #define MSP2_SEND_DSHOT_COMMAND             0x3003
 #define MSP2_GET_VTX_DEVICE_STATUS          0x3004
 #define MSP2_GET_OSD_WARNINGS               0x3005  // returns active OSD warning message text
+#define MSP2_GET_SCHEDULER_TRACE            0x3006  // returns a page of the scheduler task trace ring
+#define MSP2_GET_BLACKBOX_STATS             0x3007  // returns blackbox frame drop and device buffer statistics for the current log
+#define MSP2_GET_MOTOR_LATENCY              0x3008  // returns gyro sample to motor output latency statistics
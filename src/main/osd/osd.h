@@ -161,6 +161,7 @@ typedef enum {
     OSD_TOTAL_FLIGHTS,
     OSD_UP_DOWN_REFERENCE,
     OSD_TX_UPLINK_POWER,
+    OSD_BLACKBOX_STATS,
     OSD_ITEM_COUNT // MUST BE LAST
 } osd_items_e;
 
@@ -1168,6 +1168,12 @@ static void osdElementLogStatus(osdElementParms_t *element)
         }
     }
 }
+
+// Frames dropped in the current log and the peak occupancy of the device buffer
+static void osdElementBlackboxStats(osdElementParms_t *element)
+{
+    tfp_sprintf(element->buff, "%c%u %u%%", SYM_BBLOG, blackboxGetDroppedFrameCount(), blackboxGetStats()->bufferUsedMaxPercent);
+}
 #endif // USE_BLACKBOX
 
 static void osdElementMahDrawn(osdElementParms_t *element)
@@ -1518,6 +1524,7 @@ static const uint8_t osdElementDisplayOrder[] = {
     OSD_ANTI_GRAVITY,
 #ifdef USE_BLACKBOX
     OSD_LOG_STATUS,
+    OSD_BLACKBOX_STATS,
 #endif
     OSD_MOTOR_DIAG,
 #ifdef USE_ACC
@@ -1637,6 +1644,7 @@ const osdElementDrawFn osdElementDrawFunction[OSD_ITEM_COUNT] = {
     [OSD_MOTOR_DIAG]              = osdElementMotorDiagnostics,
 #ifdef USE_BLACKBOX
     [OSD_LOG_STATUS]              = osdElementLogStatus,
+    [OSD_BLACKBOX_STATS]          = osdElementBlackboxStats,
 #endif
 #ifdef USE_ACC
     [OSD_FLIP_ARROW]              = osdElementCrashFlipArrow,
@@ -25,15 +25,23 @@
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
 
+#include "common/sdft.h"
+
 #include "dyn_notch.h"
 
-PG_REGISTER_WITH_RESET_TEMPLATE(dynNotchConfig_t, dynNotchConfig, PG_DYN_NOTCH_CONFIG, 0);
+#ifndef DEFAULT_DYN_NOTCH_SDFT_SIZE
+#define DEFAULT_DYN_NOTCH_SDFT_SIZE SDFT_SIZE_72
+#endif
+
+PG_REGISTER_WITH_RESET_TEMPLATE(dynNotchConfig_t, dynNotchConfig, PG_DYN_NOTCH_CONFIG, 2);
 
 PG_RESET_TEMPLATE(dynNotchConfig_t, dynNotchConfig,
     .dyn_notch_min_hz = 150,
     .dyn_notch_max_hz = 600,
     .dyn_notch_q = 300,
-    .dyn_notch_count = 3
+    .dyn_notch_count = 3,
+    .dyn_notch_engine = DYN_NOTCH_ENGINE_STEPPED,
+    .dyn_notch_sdft_size = DEFAULT_DYN_NOTCH_SDFT_SIZE,
 );
 
 #endif // USE_DYN_NOTCH_FILTER
@@ -24,12 +24,19 @@
 
 #include "pg/pg.h"
 
+typedef enum {
+    DYN_NOTCH_ENGINE_STEPPED = 0,
+    DYN_NOTCH_ENGINE_ALL_AXES,
+} dynNotchEngine_e;
+
 typedef struct dynNotchConfig_s
 {
     uint16_t dyn_notch_min_hz;
     uint16_t dyn_notch_max_hz;
     uint16_t dyn_notch_q;
     uint8_t  dyn_notch_count;
+    uint8_t  dyn_notch_engine;      // dynNotchEngine_e: one axis step per loop or all axes per SDFT sample
+    uint8_t  dyn_notch_sdft_size;   // sdftSize_e: number of samples in the SDFT window
 
 } dynNotchConfig_t;
 
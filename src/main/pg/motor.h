@@ -49,6 +49,7 @@ typedef struct motorDevConfig_s {
     uint8_t  useDshotBitbang;
     uint8_t  useDshotBitbangedTimer;
     uint8_t  motorOutputReordering[MAX_SUPPORTED_MOTORS]; // Reindexing motors for "remap motors" feature in Configurator
+    uint8_t  useDshotImmediateUpdate;       // wait out the DShot telemetry deadtime instead of skipping the motor update
 } motorDevConfig_t;
 
 typedef struct motorConfig_s {
@@ -31,9 +31,15 @@
 #define SCHEDULER_RELAX_OSD 25
 #endif
 
+typedef enum {
+    SCHEDULER_MODE_PRIORITY = 0,
+    SCHEDULER_MODE_EDF,
+} schedulerMode_e;
+
 typedef struct schedulerConfig_s {
     uint16_t rxRelaxDeterminism;
     uint16_t osdRelaxDeterminism;
+    uint8_t mode;                       // schedulerMode_e, selection of non-realtime tasks
 } schedulerConfig_t;
 
 PG_DECLARE(schedulerConfig_t, schedulerConfig);
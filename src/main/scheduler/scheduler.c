@@ -46,6 +46,7 @@
 #include "flight/failsafe.h"
 
 #include "scheduler.h"
+#include "scheduler_trace.h"
 
 #include "sensors/gyro_init.h"
 
@@ -108,6 +109,20 @@ static uint32_t nextTimingCycles;
 
 static timeMs_t lastFailsafeCheckMs = 0;
 
+#ifdef USE_SCHEDULER_EDF
+typedef struct {
+    task_t *task;
+    int32_t latestStartUs;              // relative to the current time, negative once the deadline can no longer be met
+} edfHeapEntry_t;
+
+static FAST_DATA_ZERO_INIT bool edfEnabled;
+static FAST_DATA_ZERO_INIT edfHeapEntry_t edfHeap[TASK_COUNT];
+#endif
+
+#ifdef USE_SCHEDULER_TRACE
+static FAST_DATA_ZERO_INIT uint32_t traceCheckCycles;  // check function time preceding the next task execution
+#endif
+
 // No need for a linked list for the queue, since items are only inserted at startup
 
 STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT task_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
@@ -353,6 +368,10 @@ void schedulerInit(void)
     nextTimingCycles = lastTargetCycles;
 #endif
 
+#ifdef USE_SCHEDULER_EDF
+    edfEnabled = (schedulerConfig()->mode == SCHEDULER_MODE_EDF);
+#endif
+
     for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
         schedulerResetTaskStatistics(taskId);
     }
@@ -385,9 +404,17 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
         selectedTask->dynamicPriority = 0;
 
         // Execute task
+#ifdef USE_SCHEDULER_TRACE
+        const uint32_t traceStartCycles = getCycleCounter();
+#endif
         const timeUs_t currentTimeBeforeTaskCallUs = micros();
         selectedTask->attribute->taskFunc(currentTimeBeforeTaskCallUs);
         taskExecutionTimeUs = micros() - currentTimeBeforeTaskCallUs;
+#ifdef USE_SCHEDULER_TRACE
+        schedulerTraceRecord(selectedTask - tasks, traceStartCycles, getCycleCounter(), traceCheckCycles,
+            (selectedTask->attribute->staticPriority == TASK_PRIORITY_REALTIME) ? SCHEDULER_TRACE_FLAG_REALTIME : 0);
+        traceCheckCycles = 0;
+#endif
         taskTotalExecutionTime += taskExecutionTimeUs;
         selectedTask->movingSumExecutionTime10thUs += (taskExecutionTimeUs * 10) - selectedTask->movingSumExecutionTime10thUs / TASK_STATS_MOVING_SUM_COUNT;
         if (!ignoreCurrentTaskExecRate) {
@@ -423,6 +450,120 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
     return taskExecutionTimeUs;
 }
 
+// Run the check function of an event driven task, returns true if the task has been signalled
+static FAST_CODE bool schedulerCheckTask(task_t *task, timeUs_t currentTimeUs)
+{
+    if (!task->attribute->checkFunc(currentTimeUs, cmpTimeUs(currentTimeUs, task->lastExecutedAtUs))) {
+        return false;
+    }
+
+    const uint32_t checkFuncExecutionTimeUs = cmpTimeUs(micros(), currentTimeUs);
+    checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+    checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+    checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
+    checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
+    task->lastSignaledAtUs = currentTimeUs;
+
+    return true;
+}
+
+#ifdef USE_SCHEDULER_EDF
+static FAST_CODE void edfHeapPush(int *heapSize, task_t *task, int32_t latestStartUs)
+{
+    int child = (*heapSize)++;
+
+    while (child > 0) {
+        const int parent = (child - 1) / 2;
+        if (edfHeap[parent].latestStartUs <= latestStartUs) {
+            break;
+        }
+        edfHeap[child] = edfHeap[parent];
+        child = parent;
+    }
+    edfHeap[child].task = task;
+    edfHeap[child].latestStartUs = latestStartUs;
+}
+
+static FAST_CODE task_t *edfHeapPop(int *heapSize)
+{
+    task_t *task = edfHeap[0].task;
+    const edfHeapEntry_t last = edfHeap[--(*heapSize)];
+    int parent = 0;
+
+    while (true) {
+        int child = 2 * parent + 1;
+        if (child >= *heapSize) {
+            break;
+        }
+        if ((child + 1 < *heapSize) && (edfHeap[child + 1].latestStartUs < edfHeap[child].latestStartUs)) {
+            child++;
+        }
+        if (last.latestStartUs <= edfHeap[child].latestStartUs) {
+            break;
+        }
+        edfHeap[parent] = edfHeap[child];
+        parent = child;
+    }
+    edfHeap[parent] = last;
+
+    return task;
+}
+
+// Earliest deadline first task selection
+// A task is released once its period has elapsed, or when its check function signals it, and must complete
+// within one further period. Ready tasks are ordered by the latest time they can start and still meet that
+// deadline, given their anticipated execution time, and the most urgent task that fits in the time remaining
+// before the next gyro cycle is selected. If none fit, the most urgent task is returned so that it is expedited.
+static FAST_CODE task_t *schedulerSelectTaskEdf(timeUs_t currentTimeUs, int32_t schedLoopRemainingCycles, uint32_t checkCycles)
+{
+    int heapSize = 0;
+
+    for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
+        if (task->attribute->staticPriority == TASK_PRIORITY_REALTIME) {
+            continue;
+        }
+
+        timeUs_t releaseUs;
+        if (task->attribute->checkFunc) {
+            // dynamicPriority is only used to hold a signalled event driven task until it runs
+            if (task->dynamicPriority == 0) {
+                if (!schedulerCheckTask(task, currentTimeUs)) {
+                    task->taskAgePeriods = 0;
+                    continue;
+                }
+                task->dynamicPriority = 1;
+            }
+            releaseUs = task->lastSignaledAtUs;
+        } else {
+            releaseUs = task->lastExecutedAtUs + task->attribute->desiredPeriodUs;
+            if (cmpTimeUs(currentTimeUs, releaseUs) < 0) {
+                continue;
+            }
+        }
+
+        task->taskAgePeriods = 1 + cmpTimeUs(currentTimeUs, releaseUs) / task->attribute->desiredPeriodUs;
+        const int32_t latestStartUs = cmpTimeUs(releaseUs + task->attribute->desiredPeriodUs, currentTimeUs) - (task->anticipatedExecutionTime >> TASK_EXEC_TIME_SHIFT);
+        edfHeapPush(&heapSize, task, latestStartUs);
+    }
+
+    if (heapSize == 0) {
+        return NULL;
+    }
+
+    task_t *mostUrgentTask = edfHeap[0].task;
+
+    while (heapSize > 0) {
+        task_t *task = edfHeapPop(&heapSize);
+        const int32_t taskRequiredTimeCycles = (int32_t)clockMicrosToCycles((uint32_t)(task->anticipatedExecutionTime >> TASK_EXEC_TIME_SHIFT)) + checkCycles + taskGuardCycles;
+        if (!gyroEnabled || (taskRequiredTimeCycles < schedLoopRemainingCycles)) {
+            return task;
+        }
+    }
+
+    return mostUrgentTask;
+}
+#endif
+
 #if defined(UNIT_TEST)
 task_t *unittest_scheduler_selectedTask;
 uint8_t unittest_scheduler_selectedTaskDynamicPriority;
@@ -594,6 +735,11 @@ FAST_CODE void scheduler(void)
     if (!gyroEnabled || (schedLoopRemainingCycles > (int32_t)clockMicrosToCycles(CHECK_GUARD_MARGIN_US))) {
         currentTimeUs = micros();
 
+#ifdef USE_SCHEDULER_EDF
+        if (edfEnabled) {
+            selectedTask = schedulerSelectTaskEdf(currentTimeUs, schedLoopRemainingCycles, checkCycles);
+        } else
+#endif
         // Update task dynamic priorities
         for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
             if (task->attribute->staticPriority != TASK_PRIORITY_REALTIME) {
@@ -603,13 +749,7 @@ FAST_CODE void scheduler(void)
                     if (task->dynamicPriority > 0) {
                         task->taskAgePeriods = 1 + (cmpTimeUs(currentTimeUs, task->lastSignaledAtUs) / task->attribute->desiredPeriodUs);
                         task->dynamicPriority = 1 + task->attribute->staticPriority * task->taskAgePeriods;
-                    } else if (task->attribute->checkFunc(currentTimeUs, cmpTimeUs(currentTimeUs, task->lastExecutedAtUs))) {
-                        const uint32_t checkFuncExecutionTimeUs = cmpTimeUs(micros(), currentTimeUs);
-                        checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                        checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                        checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
-                        checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
-                        task->lastSignaledAtUs = currentTimeUs;
+                    } else if (schedulerCheckTask(task, currentTimeUs)) {
                         task->taskAgePeriods = 1;
                         task->dynamicPriority = 1 + task->attribute->staticPriority;
                     } else {
@@ -663,10 +803,19 @@ FAST_CODE void scheduler(void)
 
             if (!gyroEnabled || (taskRequiredTimeCycles < schedLoopRemainingCycles)) {
                 uint32_t antipatedEndCycles = nowCycles + taskRequiredTimeCycles;
+#ifdef USE_SCHEDULER_TRACE
+                traceCheckCycles = checkCycles;
+#endif
                 taskExecutionTimeUs += schedulerExecuteTask(selectedTask, currentTimeUs);
                 nowCycles = getCycleCounter();
                 int32_t cyclesOverdue = cmpTimeCycles(nowCycles, antipatedEndCycles);
 
+#ifdef USE_SCHEDULER_TRACE
+                // As with the late task statistics the non-deterministic SERIAL task is never considered late
+                if ((cyclesOverdue > 0) && ((currentTask - tasks) != TASK_SERIAL)) {
+                    schedulerTraceMarkLast(SCHEDULER_TRACE_FLAG_LATE);
+                }
+#endif
 #if defined(USE_LATE_TASK_STATISTICS)
                 if (cyclesOverdue > 0) {
                     if ((currentTask - tasks) != TASK_SERIAL) {
@@ -706,6 +855,9 @@ FAST_CODE void scheduler(void)
                 // If a task has been unable to run, then reduce it's recorded estimated run time to ensure
                 // it's ultimate scheduling
                 selectedTask->anticipatedExecutionTime *= TASK_AGE_EXPEDITE_SCALE;
+#ifdef USE_SCHEDULER_TRACE
+                schedulerTraceRecord(selectedTask - tasks, nowCycles, nowCycles, checkCycles, SCHEDULER_TRACE_FLAG_EXPEDITED);
+#endif
             }
         }
     }
@@ -178,6 +178,10 @@ typedef enum {
     TASK_SPEED_NEGOTIATION,
 #endif
 
+#ifdef USE_FLASHFS
+    TASK_FLASHFS,
+#endif
+
     /* Count of real tasks */
     TASK_COUNT,
 
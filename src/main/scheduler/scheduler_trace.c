@@ -0,0 +1,184 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Ring buffer of scheduler dispatches for offline timeline analysis.
+ *
+ * Every task run by the scheduler records its start and end cycle counter, together with the time spent
+ * in check functions before it was selected. The ring is dumped as Chrome trace events, which can be
+ * loaded directly into chrome://tracing or https://ui.perfetto.dev
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_SCHEDULER_TRACE
+
+#ifdef SIMULATOR_BUILD
+#include <stdio.h>
+#endif
+
+#include "common/maths.h"
+#include "common/printf.h"
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "drivers/system.h"
+
+#include "fc/tasks.h"
+
+#include "scheduler/scheduler.h"
+
+#include "scheduler_trace.h"
+
+#define SCHEDULER_TRACE_MASK (SCHEDULER_TRACE_SIZE - 1)
+
+STATIC_ASSERT((SCHEDULER_TRACE_SIZE & SCHEDULER_TRACE_MASK) == 0, scheduler_trace_size_not_power_of_two);
+
+static schedulerTraceEntry_t traceEntries[SCHEDULER_TRACE_SIZE];
+static FAST_DATA_ZERO_INIT uint32_t traceHead;          // total number of entries recorded
+static FAST_DATA_ZERO_INIT uint16_t traceStopCountdown; // entries left to record once a late task is seen
+static FAST_DATA_ZERO_INIT schedulerTraceState_e traceState;
+
+void schedulerTraceStart(schedulerTraceState_e state)
+{
+    traceState = SCHEDULER_TRACE_STOPPED;
+    traceHead = 0;
+    traceStopCountdown = 0;
+    traceState = state;
+}
+
+void schedulerTraceStop(void)
+{
+    traceState = SCHEDULER_TRACE_STOPPED;
+}
+
+schedulerTraceState_e schedulerTraceGetState(void)
+{
+    return traceState;
+}
+
+FAST_CODE void schedulerTraceRecord(taskId_e taskId, uint32_t startCycles, uint32_t endCycles, uint32_t checkCycles, uint8_t flags)
+{
+    if (traceState == SCHEDULER_TRACE_STOPPED) {
+        return;
+    }
+
+    schedulerTraceEntry_t *entry = &traceEntries[traceHead & SCHEDULER_TRACE_MASK];
+    entry->startCycles = startCycles;
+    entry->endCycles = endCycles;
+    entry->checkCycles = MIN(checkCycles, (uint32_t)UINT16_MAX);
+    entry->taskId = taskId;
+    entry->flags = flags;
+    traceHead++;
+
+    if (traceStopCountdown && --traceStopCountdown == 0) {
+        traceState = SCHEDULER_TRACE_STOPPED;
+    }
+}
+
+// Add flags to the most recent entry, a late task stops an armed trace once it is centred in the ring
+FAST_CODE void schedulerTraceMarkLast(uint8_t flags)
+{
+    if (traceState == SCHEDULER_TRACE_STOPPED || traceHead == 0) {
+        return;
+    }
+
+    traceEntries[(traceHead - 1) & SCHEDULER_TRACE_MASK].flags |= flags;
+
+    if ((flags & SCHEDULER_TRACE_FLAG_LATE) && traceState == SCHEDULER_TRACE_ARMED_LATE && traceStopCountdown == 0) {
+        traceStopCountdown = SCHEDULER_TRACE_SIZE / 2;
+    }
+}
+
+unsigned schedulerTraceCount(void)
+{
+    return MIN(traceHead, (uint32_t)SCHEDULER_TRACE_SIZE);
+}
+
+// Entries are indexed oldest first
+bool schedulerTraceGet(unsigned index, schedulerTraceEntry_t *entry)
+{
+    const unsigned count = schedulerTraceCount();
+
+    if (index >= count) {
+        return false;
+    }
+
+    *entry = traceEntries[(traceHead - count + index) & SCHEDULER_TRACE_MASK];
+
+    return true;
+}
+
+// Chrome trace "complete" event, or an instant event for an expedited task, with times in us relative to baseCycles
+int schedulerTraceFormatEvent(char *buf, const schedulerTraceEntry_t *entry, uint32_t baseCycles)
+{
+    const task_t *task = getTask(entry->taskId);
+    const int32_t ts = clockCyclesTo10thMicros(cmpTimeCycles(entry->startCycles, baseCycles));
+    const int tid = (entry->flags & SCHEDULER_TRACE_FLAG_REALTIME) ? 1 : 2;
+
+    if (entry->flags & SCHEDULER_TRACE_FLAG_EXPEDITED) {
+        return tfp_sprintf(buf, "{\"name\":\"%s expedited\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%d.%d,\"pid\":1,\"tid\":%d}",
+            task->attribute->taskName, ts / 10, ts % 10, tid);
+    }
+
+    const int32_t dur = clockCyclesTo10thMicros(cmpTimeCycles(entry->endCycles, entry->startCycles));
+    const int32_t check = clockCyclesTo10thMicros(entry->checkCycles);
+
+    return tfp_sprintf(buf, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%d.%d,\"dur\":%d.%d,\"pid\":1,\"tid\":%d,%s\"args\":{\"check\":%d.%d}}",
+        task->attribute->taskName, ts / 10, ts % 10, dur / 10, dur % 10, tid,
+        (entry->flags & SCHEDULER_TRACE_FLAG_LATE) ? "\"cname\":\"terrible\"," : "",
+        check / 10, check % 10);
+}
+
+#ifdef SIMULATOR_BUILD
+// Write the whole ring as a Chrome trace JSON file, stopping the trace
+bool schedulerTraceWriteFile(const char *filename)
+{
+    FILE *file = fopen(filename, "w");
+
+    if (!file) {
+        return false;
+    }
+
+    schedulerTraceStop();
+
+    schedulerTraceEntry_t entry;
+    const uint32_t baseCycles = schedulerTraceGet(0, &entry) ? entry.startCycles : 0;
+    char buf[SCHEDULER_TRACE_EVENT_LENGTH];
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (unsigned i = 0; schedulerTraceGet(i, &entry); i++) {
+        schedulerTraceFormatEvent(buf, &entry, baseCycles);
+        fprintf(file, "%s%s\n", buf, (i + 1 < schedulerTraceCount()) ? "," : "");
+    }
+    fprintf(file, "]}\n");
+
+    fclose(file);
+
+    return true;
+}
+#endif
+
+#endif // USE_SCHEDULER_TRACE
@@ -0,0 +1,65 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "scheduler/scheduler.h"
+
+#ifndef SCHEDULER_TRACE_SIZE
+#define SCHEDULER_TRACE_SIZE 256    // entries, must be a power of two
+#endif
+
+#define SCHEDULER_TRACE_EVENT_LENGTH 160    // buffer size for the longest Chrome trace event produced by schedulerTraceFormatEvent()
+
+typedef enum {
+    SCHEDULER_TRACE_FLAG_REALTIME  = 1 << 0,    // gyro, filter or PID task run at the start of the gyro cycle
+    SCHEDULER_TRACE_FLAG_LATE      = 1 << 1,    // task finished after its anticipated end time
+    SCHEDULER_TRACE_FLAG_EXPEDITED = 1 << 2,    // task could not be run and had its anticipated execution time reduced
+} schedulerTraceFlags_e;
+
+typedef enum {
+    SCHEDULER_TRACE_STOPPED = 0,
+    SCHEDULER_TRACE_RUNNING,
+    SCHEDULER_TRACE_ARMED_LATE,     // running, stops half a ring after the first late task
+} schedulerTraceState_e;
+
+typedef struct schedulerTraceEntry_s {
+    uint32_t startCycles;
+    uint32_t endCycles;
+    uint16_t checkCycles;           // time spent in check functions before the task was selected, saturated
+    uint8_t taskId;
+    uint8_t flags;
+} schedulerTraceEntry_t;
+
+void schedulerTraceStart(schedulerTraceState_e state);
+void schedulerTraceStop(void);
+schedulerTraceState_e schedulerTraceGetState(void);
+void schedulerTraceRecord(taskId_e taskId, uint32_t startCycles, uint32_t endCycles, uint32_t checkCycles, uint8_t flags);
+void schedulerTraceMarkLast(uint8_t flags);
+unsigned schedulerTraceCount(void);
+bool schedulerTraceGet(unsigned index, schedulerTraceEntry_t *entry);
+int schedulerTraceFormatEvent(char *buf, const schedulerTraceEntry_t *entry, uint32_t baseCycles);
+#ifdef SIMULATOR_BUILD
+bool schedulerTraceWriteFile(const char *filename);
+#endif
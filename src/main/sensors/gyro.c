@@ -41,6 +41,7 @@
 
 #include "drivers/bus_spi.h"
 #include "drivers/io.h"
+#include "drivers/system.h"
 
 #include "config/config.h"
 #include "fc/runtime_config.h"
@@ -80,6 +81,7 @@ static FAST_DATA_ZERO_INIT timeUs_t yawSpinTimeUs;
 static FAST_DATA_ZERO_INIT float accumulatedMeasurements[XYZ_AXIS_COUNT];
 static FAST_DATA_ZERO_INIT float gyroPrevious[XYZ_AXIS_COUNT];
 static FAST_DATA_ZERO_INIT int accumulatedMeasurementCount;
+static FAST_DATA_ZERO_INIT float accumulatedDeltaAngle[XYZ_AXIS_COUNT];
 
 static FAST_DATA_ZERO_INIT int16_t gyroSensorTemperature;
 
@@ -98,7 +100,7 @@ STATIC_UNIT_TESTED gyroDev_t * const gyroDevPtr = &gyro.gyroSensor1.gyroDev;
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 9);
+PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 11);
 
 #ifndef GYRO_CONFIG_USE_GYRO_DEFAULT
 #define GYRO_CONFIG_USE_GYRO_DEFAULT GYRO_CONFIG_USE_GYRO_1
@@ -136,6 +138,8 @@ void pgResetFn_gyroConfig(gyroConfig_t *gyroConfig)
     gyroConfig->smithPredictorStrength = 50;
     gyroConfig->smithPredictorDelay = 40;
     gyroConfig->smithPredictorFilterHz = 5;
+    gyroConfig->gyro_fusion_outlier_dps = 200;
+    gyroConfig->gyro_fifo_batch = 1;
 }
 
 FAST_CODE bool isGyroSensorCalibrationComplete(const gyroSensor_t *gyroSensor)
@@ -154,13 +158,23 @@ FAST_CODE bool gyroIsCalibrationComplete(void)
         case GYRO_CONFIG_USE_GYRO_2: {
             return isGyroSensorCalibrationComplete(&gyro.gyroSensor2);
         }
-        case GYRO_CONFIG_USE_GYRO_BOTH: {
+        case GYRO_CONFIG_USE_GYRO_BOTH:
+        case GYRO_CONFIG_USE_GYRO_FUSED: {
             return isGyroSensorCalibrationComplete(&gyro.gyroSensor1) && isGyroSensorCalibrationComplete(&gyro.gyroSensor2);
         }
 #endif
     }
 }
 
+bool gyroUsesBothSensors(void)
+{
+#ifdef USE_MULTI_GYRO
+    return gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_BOTH || gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_FUSED;
+#else
+    return false;
+#endif
+}
+
 static bool isOnFinalGyroCalibrationCycle(const gyroCalibration_t *gyroCalibration)
 {
     return gyroCalibration->cyclesRemaining == 1;
@@ -375,6 +389,28 @@ static FAST_CODE void checkForYawSpin(timeUs_t currentTimeUs)
 }
 #endif // USE_YAW_SPIN_RECOVERY
 
+// Applies the zero offset and alignment to the raw sample in gyroADCRaw
+static FAST_CODE void gyroAlignSensorSample(gyroSensor_t *gyroSensor)
+{
+    // move 16-bit gyro data into 32-bit variables to avoid overflows in calculations
+
+#if defined(USE_GYRO_SLEW_LIMITER)
+    gyroSensor->gyroDev.gyroADC[X] = gyroSlewLimiter(gyroSensor, X) - gyroSensor->gyroDev.gyroZero[X];
+    gyroSensor->gyroDev.gyroADC[Y] = gyroSlewLimiter(gyroSensor, Y) - gyroSensor->gyroDev.gyroZero[Y];
+    gyroSensor->gyroDev.gyroADC[Z] = gyroSlewLimiter(gyroSensor, Z) - gyroSensor->gyroDev.gyroZero[Z];
+#else
+    gyroSensor->gyroDev.gyroADC[X] = gyroSensor->gyroDev.gyroADCRaw[X] - gyroSensor->gyroDev.gyroZero[X];
+    gyroSensor->gyroDev.gyroADC[Y] = gyroSensor->gyroDev.gyroADCRaw[Y] - gyroSensor->gyroDev.gyroZero[Y];
+    gyroSensor->gyroDev.gyroADC[Z] = gyroSensor->gyroDev.gyroADCRaw[Z] - gyroSensor->gyroDev.gyroZero[Z];
+#endif
+
+    if (gyroSensor->gyroDev.gyroAlign == ALIGN_CUSTOM) {
+        alignSensorViaMatrix(gyroSensor->gyroDev.gyroADC, &gyroSensor->gyroDev.rotationMatrix);
+    } else {
+        alignSensorViaRotation(gyroSensor->gyroDev.gyroADC, gyroSensor->gyroDev.gyroAlign);
+    }
+}
+
 static FAST_CODE void gyroUpdateSensor(gyroSensor_t *gyroSensor)
 {
     if (!gyroSensor->gyroDev.readFn(&gyroSensor->gyroDev)) {
@@ -383,30 +419,80 @@ static FAST_CODE void gyroUpdateSensor(gyroSensor_t *gyroSensor)
     gyroSensor->gyroDev.dataReady = false;
 
     if (isGyroSensorCalibrationComplete(gyroSensor)) {
-        // move 16-bit gyro data into 32-bit variables to avoid overflows in calculations
+        gyroAlignSensorSample(gyroSensor);
+    } else {
+        performGyroCalibration(gyroSensor, gyroConfig()->gyroMovementCalibrationThreshold);
+    }
+}
 
-#if defined(USE_GYRO_SLEW_LIMITER)
-        gyroSensor->gyroDev.gyroADC[X] = gyroSlewLimiter(gyroSensor, X) - gyroSensor->gyroDev.gyroZero[X];
-        gyroSensor->gyroDev.gyroADC[Y] = gyroSlewLimiter(gyroSensor, Y) - gyroSensor->gyroDev.gyroZero[Y];
-        gyroSensor->gyroDev.gyroADC[Z] = gyroSlewLimiter(gyroSensor, Z) - gyroSensor->gyroDev.gyroZero[Z];
-#else
-        gyroSensor->gyroDev.gyroADC[X] = gyroSensor->gyroDev.gyroADCRaw[X] - gyroSensor->gyroDev.gyroZero[X];
-        gyroSensor->gyroDev.gyroADC[Y] = gyroSensor->gyroDev.gyroADCRaw[Y] - gyroSensor->gyroDev.gyroZero[Y];
-        gyroSensor->gyroDev.gyroADC[Z] = gyroSensor->gyroDev.gyroADCRaw[Z] - gyroSensor->gyroDev.gyroZero[Z];
+// Adds the scaled sample in gyroADC to the downsampler
+static FAST_CODE void gyroDownsampleAccumulate(void)
+{
+    gyroDownsampleAccumulate();
+}
+
+#ifdef USE_GYRO_FIFO_BATCH
+// Feeds every sample of a FIFO burst through alignment and the downsampler.
+// Calibration runs on the newest sample only, so it still takes gyroCalibrationDuration.
+static FAST_CODE void gyroUpdateSensorBatch(gyroSensor_t *gyroSensor)
+{
+    gyroDev_t *gyroDev = &gyroSensor->gyroDev;
+
+    if (!gyroDev->readFn(gyroDev)) {
+        return;
+    }
+    gyroDev->dataReady = false;
+
+    if (!isGyroSensorCalibrationComplete(gyroSensor)) {
+        performGyroCalibration(gyroSensor, gyroConfig()->gyroMovementCalibrationThreshold);
+        return;
+    }
+
+    const gyroFifo_t *fifo = &gyroDev->fifo;
+    for (int i = 0; i < fifo->sampleCount; i++) {
+        gyroDev->gyroADCRaw[X] = fifo->samples[i][X];
+        gyroDev->gyroADCRaw[Y] = fifo->samples[i][Y];
+        gyroDev->gyroADCRaw[Z] = fifo->samples[i][Z];
+        gyroAlignSensorSample(gyroSensor);
+
+        gyro.gyroADC[X] = gyroDev->gyroADC[X] * gyroDev->scale;
+        gyro.gyroADC[Y] = gyroDev->gyroADC[Y] * gyroDev->scale;
+        gyro.gyroADC[Z] = gyroDev->gyroADC[Z] * gyroDev->scale;
+        gyroDownsampleAccumulate();
+    }
+
+    DEBUG_SET(DEBUG_GYRO_FIFO, 0, fifo->sampleCount);
+    DEBUG_SET(DEBUG_GYRO_FIFO, 1, fifo->droppedFrames);
+    if (fifo->sampleCount) {
+        // age of the oldest sample in the batch, reconstructed from the sensor ODR
+        DEBUG_SET(DEBUG_GYRO_FIFO, 2, clockCyclesToMicros(cmpTimeCycles(getCycleCounter(), gyroFifoSampleCycles(fifo, 0))));
+    }
+#ifdef USE_GYRO_EXTI
+    DEBUG_SET(DEBUG_GYRO_FIFO, 3, clockCyclesToMicros(gyroDev->gyroDmaMaxDuration));
+#endif
+}
 #endif
 
-        if (gyroSensor->gyroDev.gyroAlign == ALIGN_CUSTOM) {
-            alignSensorViaMatrix(gyroSensor->gyroDev.gyroADC, &gyroSensor->gyroDev.rotationMatrix);
-        } else {
-            alignSensorViaRotation(gyroSensor->gyroDev.gyroADC, gyroSensor->gyroDev.gyroAlign);
-        }
+#ifdef USE_MULTI_GYRO
+static FAST_CODE void gyroDownsampleSensor(gyroSensor_t *gyroSensor, int axis, float sample)
+{
+    if (gyro.downsampleFilterEnabled) {
+        gyroSensor->sampleSum[axis] = gyro.lowpass2FilterApplyFn((filter_t *)&gyroSensor->lowpass2Filter[axis], sample);
     } else {
-        performGyroCalibration(gyroSensor, gyroConfig()->gyroMovementCalibrationThreshold);
+        gyroSensor->sampleSum[axis] += sample;
     }
 }
+#endif
 
 FAST_CODE void gyroUpdate(void)
 {
+#ifdef USE_GYRO_FIFO_BATCH
+    if (gyro.fifoBatchSize > 1) {
+        gyroUpdateSensorBatch(gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_2 ? &gyro.gyroSensor2 : &gyro.gyroSensor1);
+        return;
+    }
+#endif
+
     switch (gyro.gyroToUse) {
     case GYRO_CONFIG_USE_GYRO_1:
         gyroUpdateSensor(&gyro.gyroSensor1);
@@ -434,14 +520,38 @@ FAST_CODE void gyroUpdate(void)
             gyro.gyroADC[Z] = ((gyro.gyroSensor1.gyroDev.gyroADC[Z] * gyro.gyroSensor1.gyroDev.scale) + (gyro.gyroSensor2.gyroDev.gyroADC[Z] * gyro.gyroSensor2.gyroDev.scale)) / 2.0f;
         }
         break;
+    case GYRO_CONFIG_USE_GYRO_FUSED:
+        gyroUpdateSensor(&gyro.gyroSensor1);
+        gyroUpdateSensor(&gyro.gyroSensor2);
+        if (isGyroSensorCalibrationComplete(&gyro.gyroSensor1) && isGyroSensorCalibrationComplete(&gyro.gyroSensor2)) {
+            // each sensor is downsampled separately and fused in the filter loop, gyroADC is only a plain average for debugging
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                const float sample1 = gyro.gyroSensor1.gyroDev.gyroADC[axis] * gyro.gyroSensor1.gyroDev.scale;
+                const float sample2 = gyro.gyroSensor2.gyroDev.gyroADC[axis] * gyro.gyroSensor2.gyroDev.scale;
+                gyro.gyroADC[axis] = (sample1 + sample2) / 2.0f;
+                gyroDownsampleSensor(&gyro.gyroSensor1, axis, sample1);
+                gyroDownsampleSensor(&gyro.gyroSensor2, axis, sample2);
+            }
+            if (!gyro.downsampleFilterEnabled) {
+                gyro.sampleCount++;
+            }
+        }
+        return;
 #endif
     }
 
     if (gyro.downsampleFilterEnabled) {
         // using gyro lowpass 2 filter for downsampling
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const int32_t sample = gyro.lowpass2FilterFixed.applyFn((filter_t *)&gyro.lowpass2FilterFixed.filter[axis], filterFixedFromFloat(gyro.gyroADC[axis]));
+            gyro.sampleSum[axis] = filterFixedToFloat(sample);
+        }
+#else
         gyro.sampleSum[X] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[X], gyro.gyroADC[X]);
         gyro.sampleSum[Y] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Y], gyro.gyroADC[Y]);
         gyro.sampleSum[Z] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Z], gyro.gyroADC[Z]);
+#endif
     } else {
         // using simple averaging for downsampling
         gyro.sampleSum[X] += gyro.gyroADC[X];
@@ -481,6 +591,23 @@ FAST_CODE_NOINLINE float applySmithPredictor(smithPredictor_t *smithPredictor, f
 }
 #endif
 
+// Returns the downsampled value of one axis, the sum is reset when averaging
+static FAST_CODE float gyroDownsample(float *sampleSum, int axis)
+{
+    if (gyro.downsampleFilterEnabled) {
+        // using gyro lowpass 2 filter for downsampling
+        return sampleSum[axis];
+    }
+
+    // using simple average for downsampling
+    float gyroADCf = 0;
+    if (gyro.sampleCount) {
+        gyroADCf = sampleSum[axis] / gyro.sampleCount;
+    }
+    sampleSum[axis] = 0;
+    return gyroADCf;
+}
+
 #define GYRO_FILTER_FUNCTION_NAME filterGyro
 #define GYRO_FILTER_DEBUG_SET(mode, index, value) do { UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) do { UNUSED(axis); UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
@@ -529,6 +656,7 @@ FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
             break;
 
     case GYRO_CONFIG_USE_GYRO_BOTH:
+    case GYRO_CONFIG_USE_GYRO_FUSED:
             DEBUG_SET(DEBUG_DUAL_GYRO_RAW, 0, gyro.gyroSensor1.gyroDev.gyroADCRaw[X]);
             DEBUG_SET(DEBUG_DUAL_GYRO_RAW, 1, gyro.gyroSensor1.gyroDev.gyroADCRaw[Y]);
             DEBUG_SET(DEBUG_DUAL_GYRO_RAW, 2, gyro.gyroSensor2.gyroDev.gyroADCRaw[X]);
@@ -558,11 +686,22 @@ FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
 #endif
 
     if (!overflowDetected) {
+        float deltaAngle[XYZ_AXIS_COUNT];
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
             // integrate using trapezium rule to avoid bias
-            accumulatedMeasurements[axis] += 0.5f * (gyroPrevious[axis] + gyro.gyroADCf[axis]) * gyro.targetLooptime;
+            const float increment = 0.5f * (gyroPrevious[axis] + gyro.gyroADCf[axis]) * gyro.targetLooptime;
+            accumulatedMeasurements[axis] += increment;
+            deltaAngle[axis] = DEGREES_TO_RADIANS(increment * 1e-6f);
             gyroPrevious[axis] = gyro.gyroADCf[axis];
         }
+        // accumulate the rotation vector with the first order coning term (1/2 * phi x dtheta), so rotation of
+        // the rotation axis between attitude updates is not lost as it is when averaging the rates
+        const float coningX = 0.5f * (accumulatedDeltaAngle[Y] * deltaAngle[Z] - accumulatedDeltaAngle[Z] * deltaAngle[Y]);
+        const float coningY = 0.5f * (accumulatedDeltaAngle[Z] * deltaAngle[X] - accumulatedDeltaAngle[X] * deltaAngle[Z]);
+        const float coningZ = 0.5f * (accumulatedDeltaAngle[X] * deltaAngle[Y] - accumulatedDeltaAngle[Y] * deltaAngle[X]);
+        accumulatedDeltaAngle[X] += deltaAngle[X] + coningX;
+        accumulatedDeltaAngle[Y] += deltaAngle[Y] + coningY;
+        accumulatedDeltaAngle[Z] += deltaAngle[Z] + coningZ;
         accumulatedMeasurementCount++;
     }
 
@@ -590,6 +729,17 @@ bool gyroGetAccumulationAverage(float *accumulationAverage)
     }
 }
 
+// Returns the coning corrected rotation vector (radians) accumulated since the last call.
+// Must be called before gyroGetAccumulationAverage(), which resets the sample count.
+bool gyroGetAccumulatedDeltaAngle(float *deltaAngle)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        deltaAngle[axis] = accumulatedDeltaAngle[axis];
+        accumulatedDeltaAngle[axis] = 0.0f;
+    }
+    return accumulatedMeasurementCount > 0;
+}
+
 int16_t gyroReadSensorTemperature(gyroSensor_t gyroSensor)
 {
     if (gyroSensor.gyroDev.temperatureFn) {
@@ -611,6 +761,7 @@ void gyroReadTemperature(void)
         break;
 
     case GYRO_CONFIG_USE_GYRO_BOTH:
+    case GYRO_CONFIG_USE_GYRO_FUSED:
         gyroSensorTemperature = MAX(gyroReadSensorTemperature(gyro.gyroSensor1), gyroReadSensorTemperature(gyro.gyroSensor2));
         break;
 #endif // USE_MULTI_GYRO
@@ -661,27 +812,44 @@ void dynLpfGyroUpdate(float throttle)
         DEBUG_SET(DEBUG_DYN_LPF, 2, lrintf(cutoffFreq));
         const float gyroDt = gyro.targetLooptime * 1e-6f;
         switch (gyro.dynLpfFilter) {
-        case DYN_LPF_PT1:
+        case DYN_LPF_PT1: {
+            const float gain = pt1FilterGain(cutoffFreq, gyroDt);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt1FilterState, pt1FilterGain(cutoffFreq, gyroDt));
+                pt1FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt1FilterState, gain);
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+                pt1FilterFixedUpdateCutoff(&gyro.lowpassFilterFixed.filter[axis].pt1FilterState, gain);
+#endif
             }
             break;
+        }
         case DYN_LPF_BIQUAD:
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterUpdateLPF(&gyro.lowpassFilter[axis].biquadFilterState, cutoffFreq, gyro.targetLooptime);
-            }
+            // coefficients are shared by all axes
+            biquadFilterCoeffsUpdateLPF(&gyro.lowpassFilterCoeffs, cutoffFreq, gyro.targetLooptime);
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+            biquadFilterFixedCoeffsFromFloat(&gyro.lowpassFilterFixed.coeffs, &gyro.lowpassFilterCoeffs);
+#endif
             break;
-        case  DYN_LPF_PT2:
+        case  DYN_LPF_PT2: {
+            const float gain = pt2FilterGain(cutoffFreq, gyroDt);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt2FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt2FilterState, pt2FilterGain(cutoffFreq, gyroDt));
+                pt2FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt2FilterState, gain);
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+                pt2FilterFixedUpdateCutoff(&gyro.lowpassFilterFixed.filter[axis].pt2FilterState, gain);
+#endif
             }
             break;
-        case DYN_LPF_PT3:
+        }
+        case DYN_LPF_PT3: {
+            const float gain = pt3FilterGain(cutoffFreq, gyroDt);
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt3FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt3FilterState, pt3FilterGain(cutoffFreq, gyroDt));
+                pt3FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt3FilterState, gain);
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+                pt3FilterFixedUpdateCutoff(&gyro.lowpassFilterFixed.filter[axis].pt3FilterState, gain);
+#endif
             }
             break;
         }
+        }
     }
 }
 #endif
@@ -37,6 +37,10 @@
 
 #include "pg/pg.h"
 
+#ifdef USE_MULTI_GYRO
+#include "sensors/gyro_fusion.h"
+#endif
+
 #define LPF_MAX_HZ 1000 // so little filtering above 1000hz that if the user wants less delay, they must disable the filter
 #define DYN_LPF_MAX_HZ 1000
 
@@ -55,11 +59,27 @@
 
 typedef union gyroLowpassFilter_u {
     pt1Filter_t pt1FilterState;
-    biquadFilter_t biquadFilterState;
+    biquadFilterShared_t biquadFilterState;
     pt2Filter_t pt2FilterState;
     pt3Filter_t pt3FilterState;
 } gyroLowpassFilter_t;
 
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+typedef union gyroLowpassFilterFixed_u {
+    pt1FilterFixed_t pt1FilterState;
+    biquadFilterFixed_t biquadFilterState;
+    pt2FilterFixed_t pt2FilterState;
+    pt3FilterFixed_t pt3FilterState;
+} gyroLowpassFilterFixed_t;
+
+// fixed point copy of one float filter stage, set up from the float stage by gyroInitFilters()
+typedef struct gyroFilterFixed_s {
+    filterFixedApplyFnPtr applyFn;
+    gyroLowpassFilterFixed_t filter[XYZ_AXIS_COUNT];
+    biquadFilterFixedCoeffs_t coeffs;   // shared by all axes when the stage is a biquad
+} gyroFilterFixed_t;
+#endif
+
 typedef enum gyroDetectionFlags_e {
     GYRO_NONE_MASK = 0,
     GYRO_1_MASK = BIT(0),
@@ -79,6 +99,11 @@ typedef struct gyroCalibration_s {
 typedef struct gyroSensor_s {
     gyroDev_t gyroDev;
     gyroCalibration_t calibration;
+#ifdef USE_MULTI_GYRO
+    // per sensor downsampling, only used with GYRO_CONFIG_USE_GYRO_FUSED
+    float sampleSum[XYZ_AXIS_COUNT];
+    gyroLowpassFilter_t lowpass2Filter[XYZ_AXIS_COUNT];
+#endif
 } gyroSensor_t;
 
 #ifdef USE_SMITH_PREDICTOR
@@ -104,10 +129,14 @@ typedef struct gyro_s {
     uint8_t sampleCount;               // gyro sensor sample counter
     float sampleSum[XYZ_AXIS_COUNT];   // summed samples used for downsampling
     bool downsampleFilterEnabled;      // if true then downsample using gyro lowpass 2, otherwise use averaging
+#ifdef USE_GYRO_FIFO_BATCH
+    uint8_t fifoBatchSize;             // sensor samples read from the FIFO per gyro task
+#endif
 
     gyroSensor_t gyroSensor1;
 #ifdef USE_MULTI_GYRO
     gyroSensor_t gyroSensor2;
+    gyroFusion_t fusion;
 #endif
 
     gyroDev_t *rawSensorDev;           // pointer to the sensor providing the raw data for DEBUG_GYRO_RAW
@@ -115,17 +144,29 @@ typedef struct gyro_s {
     // lowpass gyro soft filter
     filterApplyFnPtr lowpassFilterApplyFn;
     gyroLowpassFilter_t lowpassFilter[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t lowpassFilterCoeffs;    // shared by all axes when lowpassFilter is a biquad
 
     // lowpass2 gyro soft filter
     filterApplyFnPtr lowpass2FilterApplyFn;
     gyroLowpassFilter_t lowpass2Filter[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t lowpass2FilterCoeffs;
 
-    // notch filters
+    // notch filters, coefficients are shared by all axes
     filterApplyFnPtr notchFilter1ApplyFn;
-    biquadFilter_t notchFilter1[XYZ_AXIS_COUNT];
+    biquadFilterShared_t notchFilter1[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t notchFilter1Coeffs;
 
     filterApplyFnPtr notchFilter2ApplyFn;
-    biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
+    biquadFilterShared_t notchFilter2[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t notchFilter2Coeffs;
+
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+    // the static notches and lowpass filters run in Q16.16 fixed point
+    gyroFilterFixed_t lowpassFilterFixed;
+    gyroFilterFixed_t lowpass2FilterFixed;
+    gyroFilterFixed_t notchFilter1Fixed;
+    gyroFilterFixed_t notchFilter2Fixed;
+#endif
 
 #ifdef USE_SMITH_PREDICTOR
     smithPredictor_t smithPredictor[XYZ_AXIS_COUNT];
@@ -177,6 +218,7 @@ typedef enum {
 #define GYRO_CONFIG_USE_GYRO_1      0
 #define GYRO_CONFIG_USE_GYRO_2      1
 #define GYRO_CONFIG_USE_GYRO_BOTH   2
+#define GYRO_CONFIG_USE_GYRO_FUSED  3   // both gyros filtered separately, fused by noise weighting
 
 enum {
     FILTER_LPF1 = 0,
@@ -221,6 +263,9 @@ typedef struct gyroConfig_s {
     uint8_t smithPredictorStrength;
     uint8_t smithPredictorDelay;
     uint16_t smithPredictorFilterHz;
+
+    uint16_t gyro_fusion_outlier_dps;   // disagreement at which the FUSED mode drops one gyro, 0 = off
+    uint8_t gyro_fifo_batch;            // samples read from the sensor FIFO per interrupt, 1 = read one sample per interrupt
 } gyroConfig_t;
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
@@ -228,6 +273,7 @@ PG_DECLARE(gyroConfig_t, gyroConfig);
 void gyroUpdate(void);
 void gyroFiltering(timeUs_t currentTimeUs);
 bool gyroGetAccumulationAverage(float *accumulation);
+bool gyroGetAccumulatedDeltaAngle(float *deltaAngle);
 void gyroStartCalibration(bool isFirstArmingCalibration);
 bool isFirstArmingGyroCalibrationRunning(void);
 bool gyroIsCalibrationComplete(void);
@@ -236,6 +282,7 @@ int16_t gyroGetTemperature(void);
 bool gyroOverflowDetected(void);
 bool gyroYawSpinDetected(void);
 uint16_t gyroAbsRateDps(int axis);
+bool gyroUsesBothSensors(void);
 #ifdef USE_DYN_LPF
 float dynThrottle(float throttle);
 void dynLpfGyroUpdate(float throttle);
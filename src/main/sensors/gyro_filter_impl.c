@@ -22,6 +22,8 @@
 
 static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
 {
+    float gyroADCfAxes[XYZ_AXIS_COUNT];
+
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // DEBUG_GYRO_RAW records the raw value read from the sensor (not zero offset, not scaled)
         GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_RAW, axis, gyro.rawSensorDev->gyroADCRaw[axis]);
@@ -34,32 +36,53 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 0, lrintf(gyro.gyroADC[axis]));
 
         // downsample the individual gyro samples
-        float gyroADCf = 0;
-        if (gyro.downsampleFilterEnabled) {
-            // using gyro lowpass 2 filter for downsampling
-            gyroADCf = gyro.sampleSum[axis];
-        } else {
-            // using simple average for downsampling
-            if (gyro.sampleCount) {
-                gyroADCf = gyro.sampleSum[axis] / gyro.sampleCount;
-            }
-            gyro.sampleSum[axis] = 0;
+        float gyroADCf;
+#ifdef USE_MULTI_GYRO
+        if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_FUSED) {
+            // each sensor has its own downsampling, the results are fused by noise weighting
+            const float sample1 = gyroDownsample(gyro.gyroSensor1.sampleSum, axis);
+            const float sample2 = gyroDownsample(gyro.gyroSensor2.sampleSum, axis);
+            gyroADCf = gyroFusionApply(&gyro.fusion, axis, sample1, sample2);
+
+            GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_FUSION, 0, lrintf(sample1));
+            GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_FUSION, 1, lrintf(sample2));
+            GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_FUSION, 2, lrintf(gyro.fusion.weight[axis] * 1000.0f));
+            GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_FUSION, 3, gyro.fusion.sensor[0].rejectCount + gyro.fusion.sensor[1].rejectCount);
+        } else
+#endif
+        {
+            gyroADCf = gyroDownsample(gyro.sampleSum, axis);
         }
 
         // DEBUG_GYRO_SAMPLE(1) Record the post-downsample value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(gyroADCf));
 
+        gyroADCfAxes[axis] = gyroADCf;
+    }
+
 #ifdef USE_RPM_FILTER
-        gyroADCf = rpmFilterGyro(axis, gyroADCf);
+    // the RPM notch bank filters all three axes in a single pass
+    rpmFilterGyro(gyroADCfAxes);
 #endif
 
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        float gyroADCf = gyroADCfAxes[axis];
+
         // DEBUG_GYRO_SAMPLE(2) Record the post-RPM Filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 2, lrintf(gyroADCf));
 
         // apply static notch filters and software lowpass filters
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+        int32_t gyroADCq = filterFixedFromFloat(gyroADCf);
+        gyroADCq = gyro.notchFilter1Fixed.applyFn((filter_t *)&gyro.notchFilter1Fixed.filter[axis], gyroADCq);
+        gyroADCq = gyro.notchFilter2Fixed.applyFn((filter_t *)&gyro.notchFilter2Fixed.filter[axis], gyroADCq);
+        gyroADCq = gyro.lowpassFilterFixed.applyFn((filter_t *)&gyro.lowpassFilterFixed.filter[axis], gyroADCq);
+        gyroADCf = filterFixedToFloat(gyroADCq);
+#else
         gyroADCf = gyro.notchFilter1ApplyFn((filter_t *)&gyro.notchFilter1[axis], gyroADCf);
         gyroADCf = gyro.notchFilter2ApplyFn((filter_t *)&gyro.notchFilter2[axis], gyroADCf);
         gyroADCf = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], gyroADCf);
+#endif
 
         // DEBUG_GYRO_SAMPLE(3) Record the post-static notch and lowpass filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 3, lrintf(gyroADCf));
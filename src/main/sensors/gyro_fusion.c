@@ -0,0 +1,93 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// Noise weighted fusion of two gyros.
+// Each sensor's noise is estimated per axis from the running variance of its first difference,
+// which at gyro loop rates is dominated by sensor noise rather than by actual motion.
+// The sensors are averaged with inverse variance weights, so the fused noise is never worse than the
+// quieter sensor. If the sensors disagree by more than the outlier threshold, the sensor further away
+// from the last fused value is rejected for that sample.
+
+#include <math.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "gyro_fusion.h"
+
+#define GYRO_FUSION_VARIANCE_CUTOFF_HZ 5.0f   // smoothing of the noise estimate
+#define GYRO_FUSION_VARIANCE_MIN       0.01f  // (deg/s)^2, stops a stuck sensor with no noise from taking all the weight
+
+void gyroFusionInit(gyroFusion_t *fusion, uint16_t outlierThresholdDps, uint32_t looptimeUs)
+{
+    memset(fusion, 0, sizeof(gyroFusion_t));
+
+    fusion->outlierThreshold = outlierThresholdDps;
+
+    const float gain = pt1FilterGain(GYRO_FUSION_VARIANCE_CUTOFF_HZ, looptimeUs * 1e-6f);
+    for (int i = 0; i < GYRO_FUSION_SENSOR_COUNT; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            pt1FilterInit(&fusion->sensor[i].varianceFilter[axis], gain);
+        }
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        fusion->weight[axis] = 0.5f;
+    }
+}
+
+static FAST_CODE float updateVariance(gyroFusionSensor_t *sensor, int axis, float sample)
+{
+    const float delta = sample - sensor->previous[axis];
+    sensor->previous[axis] = sample;
+
+    return MAX(pt1FilterApply(&sensor->varianceFilter[axis], sq(delta)), GYRO_FUSION_VARIANCE_MIN);
+}
+
+FAST_CODE float gyroFusionApply(gyroFusion_t *fusion, int axis, float sample1, float sample2)
+{
+    // the noise estimate keeps running on outliers, so a glitching sensor also loses weight afterwards
+    const float variance1 = updateVariance(&fusion->sensor[0], axis, sample1);
+    const float variance2 = updateVariance(&fusion->sensor[1], axis, sample2);
+
+    float fused;
+    if (fusion->outlierThreshold > 0.0f && fabsf(sample1 - sample2) > fusion->outlierThreshold) {
+        if (fabsf(sample1 - fusion->fused[axis]) > fabsf(sample2 - fusion->fused[axis])) {
+            fusion->sensor[0].rejectCount++;
+            fusion->weight[axis] = 0.0f;
+            fused = sample2;
+        } else {
+            fusion->sensor[1].rejectCount++;
+            fusion->weight[axis] = 1.0f;
+            fused = sample1;
+        }
+    } else {
+        // inverse variance weighting: w1 = (1 / v1) / (1 / v1 + 1 / v2) = v2 / (v1 + v2)
+        const float weight1 = variance2 / (variance1 + variance2);
+        fusion->weight[axis] = weight1;
+        fused = sample2 + weight1 * (sample1 - sample2);
+    }
+
+    fusion->fused[axis] = fused;
+
+    return fused;
+}
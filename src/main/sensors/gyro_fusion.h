@@ -0,0 +1,45 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+
+#include "common/axis.h"
+#include "common/filter.h"
+
+#define GYRO_FUSION_SENSOR_COUNT 2
+
+typedef struct gyroFusionSensor_s {
+    float previous[XYZ_AXIS_COUNT];             // last sample, the first difference is used as noise estimate
+    pt1Filter_t varianceFilter[XYZ_AXIS_COUNT]; // running variance of the first difference
+    uint32_t rejectCount;                       // number of samples rejected as outlier
+} gyroFusionSensor_t;
+
+typedef struct gyroFusion_s {
+    gyroFusionSensor_t sensor[GYRO_FUSION_SENSOR_COUNT];
+    float fused[XYZ_AXIS_COUNT];                // last fused output, used to decide which sensor is the outlier
+    float weight[XYZ_AXIS_COUNT];               // weight of sensor 1 in the last fused output
+    float outlierThreshold;                     // maximum disagreement in deg/s before one sensor is rejected
+} gyroFusion_t;
+
+void gyroFusionInit(gyroFusion_t *fusion, uint16_t outlierThresholdDps, uint32_t looptimeUs);
+float gyroFusionApply(gyroFusion_t *fusion, int axis, float sample1, float sample2);
@@ -111,10 +111,11 @@ static void gyroInitFilterNotch1(uint16_t notchHz, uint16_t notchCutoffHz)
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        gyro.notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterSharedApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
+        biquadFilterCoeffsUpdate(&gyro.notchFilter1Coeffs, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH, 1.0f);
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH, 1.0f);
+            biquadFilterSharedInit(&gyro.notchFilter1[axis], &gyro.notchFilter1Coeffs);
         }
     }
 }
@@ -126,10 +127,11 @@ static void gyroInitFilterNotch2(uint16_t notchHz, uint16_t notchCutoffHz)
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        gyro.notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterSharedApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
+        biquadFilterCoeffsUpdate(&gyro.notchFilter2Coeffs, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH, 1.0f);
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH, 1.0f);
+            biquadFilterSharedInit(&gyro.notchFilter2[axis], &gyro.notchFilter2Coeffs);
         }
     }
 }
@@ -138,16 +140,19 @@ static bool gyroInitLowpassFilterLpf(int slot, int type, uint16_t lpfHz, uint32_
 {
     filterApplyFnPtr *lowpassFilterApplyFn;
     gyroLowpassFilter_t *lowpassFilter = NULL;
+    biquadFilterCoeffs_t *lowpassFilterCoeffs = NULL;
 
     switch (slot) {
     case FILTER_LPF1:
         lowpassFilterApplyFn = &gyro.lowpassFilterApplyFn;
         lowpassFilter = gyro.lowpassFilter;
+        lowpassFilterCoeffs = &gyro.lowpassFilterCoeffs;
         break;
 
     case FILTER_LPF2:
         lowpassFilterApplyFn = &gyro.lowpass2FilterApplyFn;
         lowpassFilter = gyro.lowpass2Filter;
+        lowpassFilterCoeffs = &gyro.lowpass2FilterCoeffs;
         break;
 
     default:
@@ -180,12 +185,13 @@ static bool gyroInitLowpassFilterLpf(int slot, int type, uint16_t lpfHz, uint32_
         case FILTER_BIQUAD:
             if (lpfHz <= gyroFrequencyNyquist) {
 #ifdef USE_DYN_LPF
-                *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterApplyDF1;
+                *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterSharedApplyDF1;
 #else
-                *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterApply;
+                *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterSharedApply;
 #endif
+                biquadFilterCoeffsUpdateLPF(lowpassFilterCoeffs, lpfHz, looptime);
                 for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                    biquadFilterInitLPF(&lowpassFilter[axis].biquadFilterState, lpfHz, looptime);
+                    biquadFilterSharedInit(&lowpassFilter[axis].biquadFilterState, lowpassFilterCoeffs);
                 }
                 ret = true;
             }
@@ -257,6 +263,37 @@ void smithPredictorInit() {
 }
 #endif // USE_SMITH_PREDICTOR
 
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+// Mirrors an initialised float filter stage in fixed point, lowpassFilter is only needed for the pt types
+static void gyroInitFilterFixed(gyroFilterFixed_t *fixed, filterApplyFnPtr applyFn, const gyroLowpassFilter_t *lowpassFilter, const biquadFilterCoeffs_t *coeffs)
+{
+    fixed->applyFn = nullFilterFixedApply;
+
+    if (applyFn == (filterApplyFnPtr)biquadFilterSharedApply || applyFn == (filterApplyFnPtr)biquadFilterSharedApplyDF1) {
+        fixed->applyFn = (filterFixedApplyFnPtr)biquadFilterFixedApply;
+        biquadFilterFixedCoeffsFromFloat(&fixed->coeffs, coeffs);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            biquadFilterFixedInit(&fixed->filter[axis].biquadFilterState, &fixed->coeffs);
+        }
+    } else if (applyFn == (filterApplyFnPtr)pt1FilterApply) {
+        fixed->applyFn = (filterFixedApplyFnPtr)pt1FilterFixedApply;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            pt1FilterFixedInit(&fixed->filter[axis].pt1FilterState, lowpassFilter[axis].pt1FilterState.k);
+        }
+    } else if (applyFn == (filterApplyFnPtr)pt2FilterApply) {
+        fixed->applyFn = (filterFixedApplyFnPtr)pt2FilterFixedApply;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            pt2FilterFixedInit(&fixed->filter[axis].pt2FilterState, lowpassFilter[axis].pt2FilterState.k);
+        }
+    } else if (applyFn == (filterApplyFnPtr)pt3FilterApply) {
+        fixed->applyFn = (filterFixedApplyFnPtr)pt3FilterFixedApply;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            pt3FilterFixedInit(&fixed->filter[axis].pt3FilterState, lowpassFilter[axis].pt3FilterState.k);
+        }
+    }
+}
+#endif
+
 void gyroInitFilters(void)
 {
     uint16_t gyro_lpf1_init_hz = gyroConfig()->gyro_lpf1_static_hz;
@@ -274,15 +311,38 @@ void gyroInitFilters(void)
       gyro.targetLooptime
     );
 
+    uint32_t sensorLooptime = gyro.sampleLooptime;
+#ifdef USE_GYRO_FIFO_BATCH
+    // lowpass 2 runs on every sensor sample of a FIFO batch
+    sensorLooptime /= gyro.fifoBatchSize;
+#endif
+
     gyro.downsampleFilterEnabled = gyroInitLowpassFilterLpf(
       FILTER_LPF2,
       gyroConfig()->gyro_lpf2_type,
       gyroConfig()->gyro_lpf2_static_hz,
-      gyro.sampleLooptime
+      sensorLooptime
     );
 
+#ifdef USE_MULTI_GYRO
+    // in FUSED mode each sensor gets its own copy of the lowpass 2 state
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyro.gyroSensor1.lowpass2Filter[axis] = gyro.lowpass2Filter[axis];
+        gyro.gyroSensor2.lowpass2Filter[axis] = gyro.lowpass2Filter[axis];
+        gyro.gyroSensor1.sampleSum[axis] = 0.0f;
+        gyro.gyroSensor2.sampleSum[axis] = 0.0f;
+    }
+    gyroFusionInit(&gyro.fusion, gyroConfig()->gyro_fusion_outlier_dps, gyro.targetLooptime);
+#endif
+
     gyroInitFilterNotch1(gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
     gyroInitFilterNotch2(gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
+#ifdef USE_GYRO_FILTER_FIXED_POINT
+    gyroInitFilterFixed(&gyro.lowpassFilterFixed, gyro.lowpassFilterApplyFn, gyro.lowpassFilter, &gyro.lowpassFilterCoeffs);
+    gyroInitFilterFixed(&gyro.lowpass2FilterFixed, gyro.lowpass2FilterApplyFn, gyro.lowpass2Filter, &gyro.lowpass2FilterCoeffs);
+    gyroInitFilterFixed(&gyro.notchFilter1Fixed, gyro.notchFilter1ApplyFn, NULL, &gyro.notchFilter1Coeffs);
+    gyroInitFilterFixed(&gyro.notchFilter2Fixed, gyro.notchFilter2ApplyFn, NULL, &gyro.notchFilter2Coeffs);
+#endif
 #ifdef USE_DYN_LPF
     dynLpfFilterInit();
 #endif
@@ -635,6 +695,14 @@ void gyroPreInit(void)
 #endif
 }
 
+#ifdef USE_GYRO_FIFO_BATCH
+static uint8_t gyroFifoBatchSize(void)
+{
+    // Batches are only read from a single gyro, averaging or fusing two sensors needs matching sample times
+    return gyroUsesBothSensors() ? 1 : gyroConfig()->gyro_fifo_batch;
+}
+#endif
+
 bool gyroInit(void)
 {
 #ifdef USE_GYRO_OVERFLOW_CHECK
@@ -696,7 +764,7 @@ bool gyroInit(void)
     }
 
 #if defined(USE_MULTI_GYRO)
-    if ((gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_BOTH && !((gyroDetectionFlags & GYRO_ALL_MASK) == GYRO_ALL_MASK))
+    if ((gyroUsesBothSensors() && !((gyroDetectionFlags & GYRO_ALL_MASK) == GYRO_ALL_MASK))
         || (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_1 && !(gyroDetectionFlags & GYRO_1_MASK))
         || (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_2 && !(gyroDetectionFlags & GYRO_2_MASK))) {
         if (gyroDetectionFlags & GYRO_1_MASK) {
@@ -712,18 +780,22 @@ bool gyroInit(void)
     // Only allow using both gyros simultaneously if they are the same hardware type.
     if (((gyroDetectionFlags & GYRO_ALL_MASK) == GYRO_ALL_MASK) && gyro.gyroSensor1.gyroDev.gyroHardware == gyro.gyroSensor2.gyroDev.gyroHardware) {
         gyroDetectionFlags |= GYRO_IDENTICAL_MASK;
-    } else if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_BOTH) {
-        // If the user selected "BOTH" and they are not the same type, then reset to using only the first gyro.
+    } else if (gyroUsesBothSensors()) {
+        // If the user selected "BOTH" or "FUSED" and they are not the same type, then reset to using only the first gyro.
         gyro.gyroToUse = GYRO_CONFIG_USE_GYRO_1;
         gyroConfigMutable()->gyro_to_use = gyro.gyroToUse;
         eepromWriteRequired = true;
     }
 
-    if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_2 || gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_BOTH) {
+    if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_2 || gyroUsesBothSensors()) {
         static DMA_DATA uint8_t gyroBuf2[GYRO_BUF_SIZE];
         // SPI DMA buffer required per device
         gyro.gyroSensor2.gyroDev.dev.txBuf = gyroBuf2;
         gyro.gyroSensor2.gyroDev.dev.rxBuf = &gyroBuf2[GYRO_BUF_SIZE / 2];
+#ifdef USE_GYRO_FIFO_BATCH
+        static DMA_DATA uint8_t gyroFifoBuf2[GYRO_FIFO_BUF_COUNT * GYRO_FIFO_BUF_SIZE];
+        gyroFifoInit(&gyro.gyroSensor2.gyroDev.fifo, gyroFifoBuf2, gyroFifoBatchSize());
+#endif
 
         gyroInitSensor(&gyro.gyroSensor2, gyroDeviceConfig(1));
         gyro.gyroHasOverflowProtection =  gyro.gyroHasOverflowProtection && gyro.gyroSensor2.gyroDev.gyroHasOverflowProtection;
@@ -735,11 +807,15 @@ bool gyroInit(void)
         writeEEPROM();
     }
 
-    if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_1 || gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_BOTH) {
+    if (gyro.gyroToUse == GYRO_CONFIG_USE_GYRO_1 || gyroUsesBothSensors()) {
         static DMA_DATA uint8_t gyroBuf1[GYRO_BUF_SIZE];
         // SPI DMA buffer required per device
         gyro.gyroSensor1.gyroDev.dev.txBuf = gyroBuf1;
         gyro.gyroSensor1.gyroDev.dev.rxBuf = &gyroBuf1[GYRO_BUF_SIZE / 2];
+#ifdef USE_GYRO_FIFO_BATCH
+        static DMA_DATA uint8_t gyroFifoBuf1[GYRO_FIFO_BUF_COUNT * GYRO_FIFO_BUF_SIZE];
+        gyroFifoInit(&gyro.gyroSensor1.gyroDev.fifo, gyroFifoBuf1, gyroFifoBatchSize());
+#endif
         gyroInitSensor(&gyro.gyroSensor1, gyroDeviceConfig(0));
         gyro.gyroHasOverflowProtection =  gyro.gyroHasOverflowProtection && gyro.gyroSensor1.gyroDev.gyroHasOverflowProtection;
         detectedSensors[SENSOR_INDEX_GYRO] = gyro.gyroSensor1.gyroDev.gyroHardware;
@@ -758,9 +834,19 @@ bool gyroInit(void)
     }
 #endif
 
+#ifdef USE_GYRO_FIFO_BATCH
+    gyro.fifoBatchSize = 1;
+#endif
     if (gyro.rawSensorDev) {
         gyro.sampleRateHz = gyro.rawSensorDev->gyroSampleRateHz;
         gyro.accSampleRateHz = gyro.rawSensorDev->accSampleRateHz;
+#ifdef USE_GYRO_FIFO_BATCH
+        // The gyro task runs once per FIFO burst
+        if (gyroFifoIsBatching(&gyro.rawSensorDev->fifo)) {
+            gyro.fifoBatchSize = gyro.rawSensorDev->fifo.batchSize;
+            gyro.sampleRateHz /= gyro.fifoBatchSize;
+        }
+#endif
     } else {
         gyro.sampleRateHz = 0;
         gyro.accSampleRateHz = 0;
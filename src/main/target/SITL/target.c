@@ -341,7 +341,7 @@ int32_t clockCyclesToMicros(int32_t clockCycles)
 
 int32_t clockCyclesTo10thMicros(int32_t clockCycles)
 {
-    return clockCycles;
+    return clockCycles * 10;
 }
 
 uint32_t clockMicrosToCycles(uint32_t micros)
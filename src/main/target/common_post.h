@@ -213,6 +213,10 @@
 #undef USE_FLASHFS
 #endif
 
+#if defined(USE_FLASHFS) && defined(USE_FLASH_W25N01G)
+#define USE_FLASHFS_INDEX
+#endif
+
 #if (!defined(USE_SDCARD) && !defined(USE_FLASHFS)) || !defined(USE_BLACKBOX)
 #undef USE_USB_MSC
 #endif
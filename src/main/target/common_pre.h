@@ -40,6 +40,7 @@
 #define USE_DSHOT
 #define USE_DYN_NOTCH_FILTER
 #define USE_CCM_CODE
+#define USE_GYRO_FILTER_FIXED_POINT
 #endif
 
 #ifdef STM32F4
@@ -67,6 +68,9 @@
 #if defined(STM32F40_41xxx) || defined(STM32F411xE)
 #define USE_OVERCLOCK
 #endif
+#if defined(STM32F411xE)
+#define USE_GYRO_FILTER_FIXED_POINT
+#endif
 #endif // STM32F4
 
 #ifdef AT32F4
@@ -89,6 +93,7 @@
 #define USE_TIMER_MGMT
 #define USE_PERSISTENT_OBJECTS
 #define USE_LATE_TASK_STATISTICS
+#define DEFAULT_DYN_NOTCH_SDFT_SIZE     SDFT_SIZE_96 // finer resolution at 8k
 #endif // AT32F4
 
 #ifdef STM32F7
@@ -362,6 +367,8 @@ extern uint8_t _dmaram_end__;
 
 #if ((TARGET_FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 4))
 #define USE_HUFFMAN
+#define USE_BLACKBOX_RING
+#define USE_MOTOR_LATENCY_STATS
 #define USE_PINIO
 #define USE_PINIOBOX
 #endif
@@ -409,6 +416,7 @@ extern uint8_t _dmaram_end__;
 #define USE_GPS_UBLOX
 #define USE_GPS_RESCUE
 #define USE_GYRO_DLPF_EXPERIMENTAL
+#define USE_GYRO_FIFO_BATCH
 #define USE_OSD
 #define USE_OSD_OVER_MSP_DISPLAYPORT
 #define USE_MULTI_GYRO
@@ -444,6 +452,8 @@ extern uint8_t _dmaram_end__;
 #define USE_RX_LINK_UPLINK_POWER
 #define USE_CRSF_V3
 #define USE_SMITH_PREDICTOR
+#define USE_SCHEDULER_TRACE
+#define USE_SCHEDULER_EDF
 #endif
 
 #if (TARGET_FLASH_SIZE > 512)
@@ -16,12 +16,15 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
 
 extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
     #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_fielddefs.h"
+    #include "common/huffman.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -42,6 +45,8 @@ static int serialReadEnd = 0;
 #define SERIAL_BUFFER_SIZE 256
 static uint8_t serialReadBuffer[SERIAL_BUFFER_SIZE];
 static uint8_t serialWriteBuffer[SERIAL_BUFFER_SIZE];
+static bool blackboxDeviceFull = false;
+static int framesDropped = 0;
 
 serialPort_t serialTestInstance;
 
@@ -105,6 +110,8 @@ void serialTestResetBuffers()
     serialReadEnd = 0;
     memset(&serialWriteBuffer, 0, sizeof(serialWriteBuffer));
     serialWritePos = 0;
+    blackboxDeviceFull = false;
+    framesDropped = 0;
 }
 
 TEST(BlackboxEncodingTest, TestWriteUnsignedVB)
@@ -240,12 +247,317 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+TEST(BlackboxEncodingTest, TestFrameMatchesByteEncoding)
+{
+    int32_t values[] = { 0, -1, 63, -64, 300, -70000, 1 << 20, INT32_MIN };
+    uint8_t direct[64];
+
+    serialTestResetBuffers();
+    serialWrite(blackboxPort, 'P');
+    blackboxWriteSignedVBArray(values, ARRAYLEN(values));
+    blackboxWriteTag8_8SVB(values, ARRAYLEN(values));
+    const int directLength = serialWritePos;
+    memcpy(direct, serialWriteBuffer, directLength);
+
+    serialTestResetBuffers();
+    blackboxFrameBegin('P');
+    blackboxWriteSignedVBArray(values, ARRAYLEN(values));
+    blackboxWriteTag8_8SVB(values, ARRAYLEN(values));
+    EXPECT_EQ(0, serialWritePos); // nothing reaches the device until the frame is committed
+    EXPECT_EQ(directLength, blackboxFrameCommit());
+    EXPECT_EQ(directLength, serialWritePos);
+    EXPECT_EQ(0, memcmp(direct, serialWriteBuffer, directLength));
+
+    // Encoders write directly again once the frame is committed
+    blackboxWriteUnsignedVB(5);
+    EXPECT_EQ(directLength + 1, serialWritePos);
+}
+
+TEST(BlackboxEncodingTest, TestFrameOverflowIsDropped)
+{
+    serialTestResetBuffers();
+    blackboxFrameBegin('I');
+    for (int i = 0; i < BLACKBOX_FRAME_BUFFER_SIZE; i++) {
+        blackboxWriteUnsignedVB(i);
+    }
+    EXPECT_EQ(0, blackboxFrameCommit());
+    EXPECT_EQ(0, serialWritePos);
+    EXPECT_EQ(1, framesDropped);
+}
+
+TEST(BlackboxEncodingTest, TestFrameRefusedByDeviceIsCounted)
+{
+    serialTestResetBuffers();
+    blackboxDeviceFull = true;
+    blackboxFrameBegin('P');
+    blackboxWriteUnsignedVB(1);
+    EXPECT_EQ(0, blackboxFrameCommit());
+    EXPECT_EQ(0, serialWritePos);
+    EXPECT_EQ(1, framesDropped);
+}
+
+/*
+ * Reference decoder for frames committed with compression enabled. Returns the number of input bytes consumed
+ * and stores the decoded frame in out.
+ */
+static int decodeFrame(const uint8_t *in, uint8_t *out, int *outLength)
+{
+    const uint8_t *pos = in;
+
+    EXPECT_EQ(BLACKBOX_FRAME_COMPRESSED, *pos);
+    ++pos;
+
+    uint32_t length = 0;
+    for (int shift = 0; ; shift += 7) {
+        const uint8_t b = *pos++;
+        length |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+
+    uint16_t code = 0;
+    int codeLen = 0;
+    uint8_t bit = 0x80;
+    for (uint32_t symbols = 0; symbols < length; ) {
+        code = (code << 1) | ((*pos & bit) ? 1 : 0);
+        ++codeLen;
+        bit >>= 1;
+        if (bit == 0) {
+            bit = 0x80;
+            ++pos;
+        }
+        EXPECT_LE(codeLen, 16);
+        for (int i = 0; i < HUFFMAN_TABLE_SIZE - 1; i++) {
+            if (huffmanTable[i].codeLen == codeLen && huffmanTable[i].code == (uint16_t)(code << (16 - codeLen))) {
+                out[symbols++] = i;
+                code = 0;
+                codeLen = 0;
+                break;
+            }
+        }
+    }
+    if (bit != 0x80) {
+        ++pos;
+    }
+
+    *outLength = length;
+    return pos - in;
+}
+
+static uint32_t testRandomState = 12345;
+
+static int32_t testRandomDelta(int range)
+{
+    testRandomState = testRandomState * 1103515245 + 12345;
+    return (int32_t)((testRandomState >> 16) % (2 * range + 1)) - range;
+}
+
+// Encodes and commits a P frame with small deltas, as produced for a hovering quad
+static int writeTestPFrame(bool compress)
+{
+    int32_t values[8];
+
+    blackboxFrameSetCompression(compress);
+    blackboxFrameBegin('P');
+    blackboxWriteSignedVB(testRandomDelta(2));
+    for (int group = 0; group < 4; group++) {
+        for (int i = 0; i < 8; i++) {
+            values[i] = testRandomDelta(group < 2 ? 3 : 40);
+        }
+        blackboxWriteTag8_8SVB(values, ARRAYLEN(values));
+    }
+    for (int i = 0; i < 16; i++) {
+        blackboxWriteSignedVB(testRandomDelta(12));
+    }
+    const int written = blackboxFrameCommit();
+    blackboxFrameSetCompression(false);
+
+    return written;
+}
+
+TEST(BlackboxEncodingTest, TestCompressedFrameRoundTrip)
+{
+    uint8_t raw[BLACKBOX_FRAME_BUFFER_SIZE];
+    uint8_t decoded[BLACKBOX_FRAME_BUFFER_SIZE];
+
+    for (int n = 0; n < 100; n++) {
+        const uint32_t seed = testRandomState;
+
+        serialTestResetBuffers();
+        const int rawLength = writeTestPFrame(false);
+        EXPECT_EQ(rawLength, serialWritePos);
+        memcpy(raw, serialWriteBuffer, rawLength);
+
+        // Encode the same frame again with compression
+        testRandomState = seed;
+        serialTestResetBuffers();
+        const int written = writeTestPFrame(true);
+
+        EXPECT_EQ(written, serialWritePos);
+        EXPECT_LT(written, rawLength);
+        EXPECT_EQ(BLACKBOX_FRAME_COMPRESSED, serialWriteBuffer[0]);
+
+        int decodedLength;
+        EXPECT_EQ(written, decodeFrame(serialWriteBuffer, decoded, &decodedLength));
+        EXPECT_EQ(rawLength, decodedLength);
+        EXPECT_EQ(0, memcmp(raw, decoded, rawLength));
+    }
+}
+
+TEST(BlackboxEncodingTest, TestIncompressibleFrameIsWrittenRaw)
+{
+    int32_t values[] = { 0x7654321, -0x1234567, 0x5A5A5A5, -0x3C3C3C3 };
+
+    serialTestResetBuffers();
+    blackboxFrameSetCompression(true);
+    blackboxFrameBegin('I');
+    blackboxWriteSignedVBArray(values, ARRAYLEN(values));
+    const int written = blackboxFrameCommit();
+    blackboxFrameSetCompression(false);
+
+    EXPECT_EQ(written, serialWritePos);
+    EXPECT_EQ('I', serialWriteBuffer[0]);
+}
+
+TEST(BlackboxEncodingTest, BenchmarkCompressionRatio)
+{
+    int rawBytes = 0;
+    int writtenBytes = 0;
+
+    testRandomState = 1;
+    for (int n = 0; n < 1000; n++) {
+        const uint32_t seed = testRandomState;
+
+        serialTestResetBuffers();
+        rawBytes += writeTestPFrame(false);
+        testRandomState = seed;
+        serialTestResetBuffers();
+        writtenBytes += writeTestPFrame(true);
+    }
+
+    printf("[ BENCH    ] P frames: raw %d bytes, compressed %d bytes (%d%%)\n",
+        rawBytes, writtenBytes, 100 * writtenBytes / rawBytes);
+    EXPECT_LT(writtenBytes, rawBytes);
+}
+
+static int32_t readSignedVB(const uint8_t **pos)
+{
+    uint32_t value = 0;
+    for (int shift = 0; ; shift += 7) {
+        const uint8_t b = *(*pos)++;
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+/*
+ * Encode a signal with the adaptive predictor, decode it again the way a log decoder would and return the number
+ * of bytes used. The predictor is reselected every windowLength samples, as it is at each I frame.
+ */
+static int adaptivePredictorRoundTrip(const int16_t *signal, int length, int windowLength, uint8_t *lastPredictor)
+{
+    blackboxAdaptivePredictor_t state;
+    blackboxAdaptivePredictorInit(&state);
+
+    int bytes = 0;
+    int16_t decoded[2] = { signal[0], signal[1] };
+    for (int n = 2; n < length; n++) {
+        if (n % windowLength == 0) {
+            blackboxAdaptivePredictorSelect(&state);
+        }
+        const uint8_t predictor = state.predictor;
+
+        serialTestResetBuffers();
+        blackboxWriteArrayUsingAdaptivePredictor(&state, &signal[n], &signal[n - 1], &signal[n - 2], 1);
+        bytes += serialWritePos;
+
+        const uint8_t *pos = serialWriteBuffer;
+        const int16_t value = blackboxAdaptivePredict(predictor, decoded[1], decoded[0]) + readSignedVB(&pos);
+        EXPECT_EQ(signal[n], value);
+        EXPECT_EQ(serialWritePos, pos - serialWriteBuffer);
+        decoded[0] = decoded[1];
+        decoded[1] = value;
+    }
+    *lastPredictor = state.predictor;
+
+    return bytes;
+}
+
+#define ADAPTIVE_TEST_LENGTH 512
+#define ADAPTIVE_TEST_WINDOW 32
+
+TEST(BlackboxEncodingTest, TestAdaptivePredictorSelection)
+{
+    int16_t signal[ADAPTIVE_TEST_LENGTH];
+    uint8_t predictor;
+
+    // A smooth ramp is predicted exactly by a straight line
+    for (int n = 0; n < ADAPTIVE_TEST_LENGTH; n++) {
+        signal[n] = 3 * n * n / 64 - 1000;
+    }
+    adaptivePredictorRoundTrip(signal, ADAPTIVE_TEST_LENGTH, ADAPTIVE_TEST_WINDOW, &predictor);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE, predictor);
+
+    // A signal that holds its value between large steps is best predicted by the previous value
+    for (int n = 0; n < ADAPTIVE_TEST_LENGTH; n++) {
+        signal[n] = (n / 40) * 700;
+    }
+    adaptivePredictorRoundTrip(signal, ADAPTIVE_TEST_LENGTH, ADAPTIVE_TEST_WINDOW, &predictor);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, predictor);
+
+    // Noise alternating around a constant is best predicted by the average of the last two values
+    for (int n = 0; n < ADAPTIVE_TEST_LENGTH; n++) {
+        signal[n] = 200 + ((n & 1) ? 90 : -90);
+    }
+    adaptivePredictorRoundTrip(signal, ADAPTIVE_TEST_LENGTH, ADAPTIVE_TEST_WINDOW, &predictor);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, predictor);
+}
+
+TEST(BlackboxEncodingTest, BenchmarkAdaptivePredictor)
+{
+    int16_t signal[ADAPTIVE_TEST_LENGTH];
+    uint8_t predictor;
+
+    // Filtered gyro during fast flips, logged at a reduced P ratio: large slopes with a little noise
+    testRandomState = 7;
+    for (int n = 0; n < ADAPTIVE_TEST_LENGTH; n++) {
+        signal[n] = lrintf(1000.0f * sinf(n * 0.1f)) + testRandomDelta(2);
+    }
+
+    const int adaptiveBytes = adaptivePredictorRoundTrip(signal, ADAPTIVE_TEST_LENGTH, ADAPTIVE_TEST_WINDOW, &predictor);
+    // A window longer than the signal never leaves the initial average predictor
+    const int averageBytes = adaptivePredictorRoundTrip(signal, ADAPTIVE_TEST_LENGTH, ADAPTIVE_TEST_LENGTH, &predictor);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, predictor);
+
+    printf("[ BENCH    ] gyro field: average predictor %d bytes, adaptive %d bytes\n", averageBytes, adaptiveBytes);
+    EXPECT_LT(adaptiveBytes, averageBytes);
+}
+
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
 int32_t blackboxHeaderBudget;
 void mspSerialAllocatePorts(void) {}
 void blackboxWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+bool blackboxWriteBuf(const uint8_t *data, int length)
+{
+    if (blackboxDeviceFull) {
+        return false;
+    }
+    serialWriteBuf(blackboxPort, data, length);
+    return true;
+}
+void blackboxStatsRecordFrame(uint8_t frameType, bool logged)
+{
+    UNUSED(frameType);
+    if (!logged) {
+        framesDropped++;
+    }
+}
 int blackboxWriteString(const char *s)
 {
     const uint8_t *pos = (uint8_t*)s;
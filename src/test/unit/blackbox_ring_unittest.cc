@@ -0,0 +1,150 @@
+/*
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_ring.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static void appendFrame(uint8_t frameType, int length)
+{
+    uint8_t frame[16];
+
+    memset(frame, frameType, sizeof(frame));
+    EXPECT_TRUE(blackboxRingAppend(frame, length));
+}
+
+static void appendSyncFrame(timeMs_t timeMs)
+{
+    blackboxRingMarkSyncPoint(timeMs);
+    appendFrame('E', 3);
+}
+
+// Read the next frame and return its type, or 0 if the ring has nothing to log
+static uint8_t readFrame(int *length)
+{
+    uint8_t frame[16];
+
+    *length = blackboxRingPeek(frame, sizeof(frame));
+    if (*length == 0) {
+        return 0;
+    }
+    blackboxRingPop();
+
+    return frame[0];
+}
+
+TEST(BlackboxRingTest, TestReadStartsAtSyncPoint)
+{
+    blackboxRingReset();
+    appendFrame('P', 2);
+    appendSyncFrame(10);
+    appendFrame('I', 5);
+    appendFrame('P', 2);
+    appendSyncFrame(20);
+    appendFrame('I', 5);
+
+    int length;
+    EXPECT_EQ('E', readFrame(&length));
+    EXPECT_EQ(3, length);
+    EXPECT_EQ('I', readFrame(&length));
+    EXPECT_EQ(5, length);
+    EXPECT_EQ('P', readFrame(&length));
+    EXPECT_EQ(2, length);
+    // The stream is continuous, so the second sync point is not needed
+    EXPECT_EQ('I', readFrame(&length));
+    EXPECT_EQ(0, readFrame(&length));
+    EXPECT_EQ(0, blackboxRingGetUsed());
+}
+
+TEST(BlackboxRingTest, TestOverflowResyncs)
+{
+    blackboxRingReset();
+    appendSyncFrame(10);
+    appendFrame('I', 10);
+
+    int length;
+    EXPECT_EQ('E', readFrame(&length));
+
+    // Push the rest of the first I interval out of the ring
+    for (int i = 0; i < 5; i++) {
+        appendFrame('P', 10);
+    }
+    appendSyncFrame(20);
+    appendFrame('I', 10);
+    appendFrame('P', 10);
+    EXPECT_LE(blackboxRingGetUsed(), 64);
+
+    // Reading continues from the next sync point, whose resume event covers the gap
+    EXPECT_EQ('E', readFrame(&length));
+    EXPECT_EQ('I', readFrame(&length));
+    EXPECT_EQ('P', readFrame(&length));
+    EXPECT_EQ(0, readFrame(&length));
+}
+
+TEST(BlackboxRingTest, TestTrimDropsOldHistory)
+{
+    blackboxRingReset();
+    appendSyncFrame(100);
+    appendFrame('I', 2);
+    appendSyncFrame(200);
+    appendFrame('I', 2);
+    appendFrame('P', 2);
+    appendSyncFrame(300);
+    appendFrame('I', 2);
+
+    blackboxRingTrim(150);
+
+    int length;
+    EXPECT_EQ('E', readFrame(&length));
+    EXPECT_EQ('I', readFrame(&length));
+    EXPECT_EQ('P', readFrame(&length));
+    EXPECT_EQ('I', readFrame(&length));
+    EXPECT_EQ(0, readFrame(&length));
+}
+
+TEST(BlackboxRingTest, TestFramesWrapAround)
+{
+    blackboxRingReset();
+
+    int length;
+    for (int i = 0; i < 20; i++) {
+        appendSyncFrame(i);
+        appendFrame('I', 7);
+        EXPECT_EQ('E', readFrame(&length));
+        EXPECT_EQ('I', readFrame(&length));
+        EXPECT_EQ(7, length);
+        blackboxRingTrim(i + 1);
+    }
+    EXPECT_EQ(0, blackboxRingGetUsed());
+}
+
+TEST(BlackboxRingTest, TestOversizedFrameIsRefused)
+{
+    uint8_t frame[64];
+
+    blackboxRingReset();
+    EXPECT_FALSE(blackboxRingAppend(frame, sizeof(frame)));
+    EXPECT_EQ(0, blackboxRingGetUsed());
+}
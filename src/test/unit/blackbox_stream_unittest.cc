@@ -0,0 +1,259 @@
+/*
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_stream.h"
+    #include "common/crc.h"
+    #include "common/maths.h"
+
+    #include "drivers/serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TX_BUFFER_SIZE 256
+
+static serialPort_t testPort;
+static std::vector<uint8_t> txBuffer;   // Written to the port but not yet on the wire
+static std::vector<uint8_t> wire;       // Received by the recorder
+static std::vector<uint8_t> rxBuffer;   // Sent by the recorder
+
+static void resetPort(bool flowControl)
+{
+    txBuffer.clear();
+    wire.clear();
+    rxBuffer.clear();
+    blackboxStreamInit(&testPort, flowControl);
+}
+
+// Move what the UART sends in one loop iteration onto the wire
+static void transmit(int bytes)
+{
+    const int count = MIN(bytes, (int)txBuffer.size());
+    wire.insert(wire.end(), txBuffer.begin(), txBuffer.begin() + count);
+    txBuffer.erase(txBuffer.begin(), txBuffer.begin() + count);
+}
+
+static void fillFrame(uint8_t *frame, int length, uint32_t seed)
+{
+    for (int i = 0; i < length; i++) {
+        frame[i] = (seed * 31 + i * 7) & 0xff;
+    }
+}
+
+/*
+ * Reference host-side decoder. Appends the payload of every intact packet to log and returns the number of packets
+ * that were lost, which includes the ones that failed the CRC.
+ */
+static int decodeStream(const std::vector<uint8_t> &in, std::vector<uint8_t> &log)
+{
+    int lost = 0;
+    uint16_t expectedSequence = 0;
+    size_t pos = 0;
+
+    while (pos + BLACKBOX_STREAM_HEADER_SIZE + BLACKBOX_STREAM_CRC_SIZE <= in.size()) {
+        if (in[pos] != BLACKBOX_STREAM_SYNC_1 || in[pos + 1] != BLACKBOX_STREAM_SYNC_2) {
+            pos++;
+            continue;
+        }
+
+        const uint16_t sequence = in[pos + 2] | (in[pos + 3] << 8);
+        const int length = in[pos + 4];
+        const size_t packetSize = BLACKBOX_STREAM_HEADER_SIZE + length + BLACKBOX_STREAM_CRC_SIZE;
+        if (length > BLACKBOX_STREAM_PAYLOAD_SIZE || pos + packetSize > in.size()) {
+            pos++;
+            continue;
+        }
+
+        const uint16_t crc = crc16_ccitt_update(0, &in[pos + 2], BLACKBOX_STREAM_HEADER_SIZE - 2 + length);
+        const size_t crcPos = pos + BLACKBOX_STREAM_HEADER_SIZE + length;
+        if ((in[crcPos] | (in[crcPos + 1] << 8)) != crc) {
+            pos++;
+            continue;
+        }
+
+        lost += (uint16_t)(sequence - expectedSequence);
+        expectedSequence = sequence + 1;
+        log.insert(log.end(), in.begin() + pos + BLACKBOX_STREAM_HEADER_SIZE, in.begin() + crcPos);
+        pos += packetSize;
+    }
+
+    return lost;
+}
+
+static void flushAll(int bytesPerIteration)
+{
+    for (int i = 0; i < 100 && !blackboxStreamFlushForce(); i++) {
+        transmit(bytesPerIteration);
+    }
+    EXPECT_TRUE(blackboxStreamFlushForce());
+}
+
+TEST(BlackboxStreamTest, TestStreamAt2MbaudIsLossless)
+{
+    // 8kHz loop, 2Mbaud is 200000 bytes/s or 25 bytes per iteration
+    const int bytesPerIteration = 25;
+    std::vector<uint8_t> logged;
+    uint8_t frame[32];
+
+    resetPort(false);
+
+    for (int i = 0; i < 8000; i++) {
+        const int length = 10 + (i * 7) % 21;
+        fillFrame(frame, length, i);
+        EXPECT_TRUE(blackboxStreamWrite(frame, length));
+        logged.insert(logged.end(), frame, frame + length);
+
+        blackboxStreamFlush();
+        transmit(bytesPerIteration);
+    }
+    flushAll(bytesPerIteration);
+
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(0, decodeStream(wire, decoded));
+    EXPECT_TRUE(decoded == logged);
+
+    printf("[ BENCH    ] framed stream: %d log bytes in %d bytes on the wire (%d%%)\n",
+        (int)logged.size(), (int)wire.size(), (int)(wire.size() * 100 / logged.size()));
+}
+
+TEST(BlackboxStreamTest, TestFrameIsWrittenWholeOrNotAtAll)
+{
+    std::vector<uint8_t> logged;
+    uint8_t frame[200];
+
+    resetPort(false);
+
+    // Nothing is sent, so the tx buffer fills up and frames start being refused
+    int refused = 0;
+    for (int i = 0; i < 20; i++) {
+        fillFrame(frame, sizeof(frame), i);
+        if (blackboxStreamWrite(frame, sizeof(frame))) {
+            logged.insert(logged.end(), frame, frame + sizeof(frame));
+        } else {
+            refused++;
+        }
+        EXPECT_LE(txBuffer.size(), TX_BUFFER_SIZE);
+    }
+    EXPECT_GT(refused, 0);
+    flushAll(TX_BUFFER_SIZE);
+
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(0, decodeStream(wire, decoded));
+    EXPECT_TRUE(decoded == logged);
+}
+
+TEST(BlackboxStreamTest, TestFlowControlHoldsStream)
+{
+    std::vector<uint8_t> logged;
+    uint8_t frame[20];
+
+    resetPort(true);
+
+    for (int i = 0; i < 300; i++) {
+        if (i == 100) {
+            rxBuffer.push_back(BLACKBOX_STREAM_XOFF);
+        } else if (i == 200) {
+            rxBuffer.push_back(BLACKBOX_STREAM_XON);
+        }
+
+        fillFrame(frame, sizeof(frame), i);
+        const bool written = blackboxStreamWrite(frame, sizeof(frame));
+        EXPECT_EQ(i < 100 || i >= 200, written);
+        if (written) {
+            logged.insert(logged.end(), frame, frame + sizeof(frame));
+        }
+
+        const size_t sent = wire.size() + txBuffer.size();
+        blackboxStreamFlush();
+        if (i >= 100 && i < 200) {
+            // Held packets are not handed to the UART
+            EXPECT_EQ(sent, wire.size() + txBuffer.size());
+        }
+        transmit(64);
+    }
+    flushAll(64);
+
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(0, decodeStream(wire, decoded));
+    EXPECT_TRUE(decoded == logged);
+}
+
+TEST(BlackboxStreamTest, TestDecoderDetectsCorruptPacket)
+{
+    uint8_t frame[BLACKBOX_STREAM_PAYLOAD_SIZE];
+
+    resetPort(false);
+
+    for (int i = 0; i < 3; i++) {
+        fillFrame(frame, sizeof(frame), i);
+        EXPECT_TRUE(blackboxStreamWrite(frame, sizeof(frame)));
+        transmit(TX_BUFFER_SIZE);
+    }
+    flushAll(TX_BUFFER_SIZE);
+    ASSERT_EQ(3 * BLACKBOX_STREAM_PACKET_SIZE, wire.size());
+
+    wire[BLACKBOX_STREAM_PACKET_SIZE + BLACKBOX_STREAM_HEADER_SIZE + 10] ^= 0x01;
+
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(1, decodeStream(wire, decoded));
+    EXPECT_EQ(2 * BLACKBOX_STREAM_PAYLOAD_SIZE, decoded.size());
+}
+
+// STUBS
+extern "C" {
+uint32_t serialTxBytesFree(const serialPort_t *instance)
+{
+    EXPECT_EQ(&testPort, instance);
+    return TX_BUFFER_SIZE - txBuffer.size();
+}
+
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count)
+{
+    EXPECT_EQ(&testPort, instance);
+    EXPECT_LE(txBuffer.size() + count, TX_BUFFER_SIZE);
+    txBuffer.insert(txBuffer.end(), data, data + count);
+}
+
+bool isSerialTransmitBufferEmpty(const serialPort_t *instance)
+{
+    EXPECT_EQ(&testPort, instance);
+    return txBuffer.empty();
+}
+
+uint32_t serialRxBytesWaiting(const serialPort_t *instance)
+{
+    EXPECT_EQ(&testPort, instance);
+    return rxBuffer.size();
+}
+
+uint8_t serialRead(serialPort_t *instance)
+{
+    EXPECT_EQ(&testPort, instance);
+    const uint8_t c = rxBuffer.front();
+    rxBuffer.erase(rxBuffer.begin());
+    return c;
+}
+}
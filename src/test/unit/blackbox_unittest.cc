@@ -369,8 +369,11 @@ bool isModeActivationConditionPresent(boxId_e) {return false;}
 uint32_t millis(void) {return 0;}
 bool sensors(uint32_t) {return false;}
 void serialWrite(serialPort_t *, uint8_t) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
 uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
+uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
+uint8_t serialRead(serialPort_t *) {return 0;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
 const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
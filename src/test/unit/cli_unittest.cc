@@ -25,6 +25,7 @@
 extern "C" {
     #include "platform.h"
     #include "target.h"
+    #include "blackbox/blackbox_io.h"
     #include "build/version.h"
     #include "cli/cli.h"
     #include "cli/settings.h"
@@ -307,6 +308,7 @@ uint16_t averageSystemLoadPercent = 0;
 timeDelta_t getTaskDeltaTimeUs(taskId_e){ return 0; }
 uint16_t currentRxRefreshRate = 9000;
 armingDisableFlags_e getArmingDisableFlags(void) { return ARMING_DISABLED_NO_GYRO; }
+const blackboxStats_t *blackboxGetStats(void) { static blackboxStats_t stats; return &stats; }
 
 const char *armingDisableFlagNames[]= {
 "DUMMYDISABLEFLAGNAME"
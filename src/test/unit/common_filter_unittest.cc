@@ -22,6 +22,8 @@
 
 #include <math.h>
 
+#include <chrono>
+
 extern "C" {
     #include "common/filter.h"
 }
@@ -114,3 +116,505 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestBiquadFilterSharedMatchesBiquad)
+{
+    biquadFilter_t reference[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterShared_t shared[XYZ_AXIS_COUNT];
+
+    biquadFilterCoeffsUpdate(&coeffs, 180.0f, 125, 3.0f, FILTER_NOTCH, 1.0f);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&reference[axis], 180.0f, 125, 3.0f, FILTER_NOTCH, 1.0f);
+        biquadFilterSharedInit(&shared[axis], &coeffs);
+    }
+    EXPECT_FLOAT_EQ(reference[0].b0, coeffs.b0);
+    EXPECT_FLOAT_EQ(reference[0].a2, coeffs.a2);
+
+    for (int i = 0; i < 500; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float sample = 100.0f * sinf(0.3f * i + axis);
+            EXPECT_FLOAT_EQ(biquadFilterApply(&reference[axis], sample), biquadFilterSharedApply(&shared[axis], sample));
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterSharedUpdateRetunesAllInstances)
+{
+    biquadFilter_t reference[XYZ_AXIS_COUNT];
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterShared_t shared[XYZ_AXIS_COUNT];
+
+    biquadFilterCoeffsUpdateLPF(&coeffs, 100.0f, 125);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInitLPF(&reference[axis], 100.0f, 125);
+        biquadFilterSharedInit(&shared[axis], &coeffs);
+    }
+
+    for (int i = 0; i < 500; i++) {
+        if (i == 250) {
+            // one update on the shared block replaces one update per axis
+            biquadFilterCoeffsUpdateLPF(&coeffs, 250.0f, 125);
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                biquadFilterUpdateLPF(&reference[axis], 250.0f, 125);
+            }
+        }
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float sample = 100.0f * sinf(0.3f * i + axis);
+            EXPECT_FLOAT_EQ(biquadFilterApplyDF1(&reference[axis], sample), biquadFilterSharedApplyDF1(&shared[axis], sample));
+        }
+    }
+}
+
+// 8 motors with 3 harmonics, as on an octo with default RPM filter settings
+#define NOTCH_BANK_TEST_SECTIONS 24
+#define NOTCH_BANK_TEST_LOOPTIME 125
+
+static float notchBankTestFrequency(int section)
+{
+    return 100.0f + 37.0f * section;
+}
+
+static float notchBankTestSample(int i, int axis)
+{
+    return 200.0f * sinf(0.05f * i + axis) + 50.0f * sinf(0.9f * i * (axis + 1));
+}
+
+static void notchBankTestInit(biquadFilter_t notch[XYZ_AXIS_COUNT][NOTCH_BANK_TEST_SECTIONS], biquadNotchBank_t *bank)
+{
+    biquadNotchBankInit(bank, NOTCH_BANK_TEST_SECTIONS);
+    for (int section = 0; section < NOTCH_BANK_TEST_SECTIONS; section++) {
+        const float weight = (section % 3) ? 1.0f : 0.5f;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            biquadFilterInit(&notch[axis][section], notchBankTestFrequency(section), NOTCH_BANK_TEST_LOOPTIME, 5.0f, FILTER_NOTCH, weight);
+        }
+        biquadNotchBankUpdate(bank, section, notchBankTestFrequency(section), NOTCH_BANK_TEST_LOOPTIME, 5.0f, weight);
+    }
+}
+
+TEST(FilterUnittest, TestBiquadNotchBankInit)
+{
+    biquadNotchBank_t bank;
+
+    biquadNotchBankInit(&bank, 6);
+    EXPECT_EQ(6, bank.count);
+    EXPECT_EQ(0, bank.x1[0][X]);
+    EXPECT_EQ(0, bank.y2[5][Z]);
+
+    // requests beyond the bank size are clamped
+    biquadNotchBankInit(&bank, BIQUAD_NOTCH_BANK_SIZE + 1);
+    EXPECT_EQ(BIQUAD_NOTCH_BANK_SIZE, bank.count);
+}
+
+TEST(FilterUnittest, TestBiquadNotchBankMatchesCascade)
+{
+    biquadFilter_t notch[XYZ_AXIS_COUNT][NOTCH_BANK_TEST_SECTIONS];
+    biquadNotchBank_t bank;
+    notchBankTestInit(notch, &bank);
+
+    for (int i = 0; i < 1000; i++) {
+        float values[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float value = notchBankTestSample(i, axis);
+            for (int section = 0; section < NOTCH_BANK_TEST_SECTIONS; section++) {
+                value = biquadFilterApplyDF1Weighted(&notch[axis][section], value);
+            }
+            values[axis] = value;
+        }
+
+        float bankValues[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            bankValues[axis] = notchBankTestSample(i, axis);
+        }
+        biquadNotchBankApply(&bank, bankValues);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_NEAR(values[axis], bankValues[axis], 1e-2f);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadNotchBankRejectsCenterFrequency)
+{
+    biquadNotchBank_t bank;
+    biquadNotchBankInit(&bank, 1);
+    biquadNotchBankUpdate(&bank, 0, 200.0f, NOTCH_BANK_TEST_LOOPTIME, 5.0f, 1.0f);
+
+    float peak = 0.0f;
+    for (int i = 0; i < 4000; i++) {
+        const float sample = sinf(2.0f * M_PI * 200.0f * i * NOTCH_BANK_TEST_LOOPTIME * 1e-6f);
+        float values[XYZ_AXIS_COUNT] = { sample, sample, sample };
+        biquadNotchBankApply(&bank, values);
+        if (i > 3000) {
+            peak = fmaxf(peak, fabsf(values[Y]));
+        }
+    }
+    EXPECT_LT(peak, 0.05f);
+}
+
+// Not a pass/fail test: compares the batched notch bank against one biquadFilterApplyDF1Weighted() call per
+// axis, motor and harmonic. Absolute numbers are only meaningful relative to each other on the same host.
+TEST(FilterUnittest, BenchmarkBiquadNotchBank)
+{
+    const int iterations = 20000;
+    biquadFilter_t notch[XYZ_AXIS_COUNT][NOTCH_BANK_TEST_SECTIONS];
+    biquadNotchBank_t bank;
+    notchBankTestInit(notch, &bank);
+
+    float sink = 0.0f;
+
+    const auto cascadeStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float value = notchBankTestSample(i & 0xff, axis);
+            for (int section = 0; section < NOTCH_BANK_TEST_SECTIONS; section++) {
+                value = biquadFilterApplyDF1Weighted(&notch[axis][section], value);
+            }
+            sink += value;
+        }
+    }
+    const auto cascadeEnd = std::chrono::steady_clock::now();
+
+    const auto bankStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        float values[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            values[axis] = notchBankTestSample(i & 0xff, axis);
+        }
+        biquadNotchBankApply(&bank, values);
+        sink += values[X] + values[Y] + values[Z];
+    }
+    const auto bankEnd = std::chrono::steady_clock::now();
+
+    const double cascadeNs = std::chrono::duration<double, std::nano>(cascadeEnd - cascadeStart).count() / iterations;
+    const double bankNs = std::chrono::duration<double, std::nano>(bankEnd - bankStart).count() / iterations;
+    printf("[ BENCH    ] %d notches x %d axes: cascade %.0f ns/sample, bank %.0f ns/sample\n",
+        NOTCH_BANK_TEST_SECTIONS, XYZ_AXIS_COUNT, cascadeNs, bankNs);
+
+    EXPECT_TRUE(isfinite(sink));
+}
+
+static float notchCenterHz(float b0, float b1, float looptimeS)
+{
+    // notch coefficients have b1 / b0 = -2 * cos(omega)
+    return acosf(-b1 / (2.0f * b0)) / (2.0f * M_PI * looptimeS);
+}
+
+// Accuracy harness: table lookup against the full biquadFilterCoeffsUpdate() over the rpm_filter_q range at 8k
+TEST(FilterUnittest, TestBiquadNotchTableAccuracy)
+{
+    const float looptimeS = NOTCH_BANK_TEST_LOOPTIME * 1e-6f;
+    static biquadNotchTable_t table;
+
+    float maxCoeffError = 0.0f;
+    float maxCenterErrorHz = 0.0f;
+    for (float q = 2.5f; q <= 30.0f; q *= 2.0f) {
+        biquadNotchTableInit(&table, q);
+        for (float frequency = 50.0f; frequency < 0.48f / looptimeS; frequency += 7.3f) {
+            biquadFilterCoeffs_t exact;
+            biquadFilterCoeffs_t fast;
+            biquadFilterCoeffsUpdate(&exact, frequency, NOTCH_BANK_TEST_LOOPTIME, q, FILTER_NOTCH, 1.0f);
+            biquadNotchTableLookup(&table, frequency * looptimeS, &fast);
+
+            maxCoeffError = fmaxf(maxCoeffError, fabsf(exact.b0 - fast.b0));
+            maxCoeffError = fmaxf(maxCoeffError, fabsf(exact.b1 - fast.b1));
+            maxCoeffError = fmaxf(maxCoeffError, fabsf(exact.a2 - fast.a2));
+            maxCenterErrorHz = fmaxf(maxCenterErrorHz, fabsf(notchCenterHz(fast.b0, fast.b1, looptimeS) - frequency));
+        }
+    }
+    printf("[ ACCURACY ] notch table: max coefficient error %.2e, max centre error %.3f Hz\n", maxCoeffError, maxCenterErrorHz);
+
+    EXPECT_LT(maxCoeffError, 2e-4f);
+    EXPECT_LT(maxCenterErrorHz, 2.0f);
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableEndpoints)
+{
+    static biquadNotchTable_t table;
+    biquadNotchTableInit(&table, 5.0f);
+
+    biquadFilterCoeffs_t exact;
+    biquadFilterCoeffs_t fast;
+
+    // table entries are exact, out of range frequencies are clamped to 0..nyquist
+    biquadFilterCoeffsUpdate(&exact, 0.25f, 1000000, 5.0f, FILTER_NOTCH, 1.0f);
+    biquadNotchTableLookup(&table, 0.25f, &fast);
+    EXPECT_FLOAT_EQ(exact.b0, fast.b0);
+    EXPECT_FLOAT_EQ(exact.a2, fast.a2);
+
+    biquadFilterCoeffsUpdate(&exact, 0.5f, 1000000, 5.0f, FILTER_NOTCH, 1.0f);
+    biquadNotchTableLookup(&table, 0.7f, &fast);
+    EXPECT_FLOAT_EQ(exact.b0, fast.b0);
+    EXPECT_FLOAT_EQ(exact.b1, fast.b1);
+
+    biquadFilterCoeffsUpdate(&exact, 0.0f, 1000000, 5.0f, FILTER_NOTCH, 1.0f);
+    biquadNotchTableLookup(&table, -0.1f, &fast);
+    EXPECT_FLOAT_EQ(exact.b1, fast.b1);
+}
+
+// Not a pass/fail test: cost of retuning all 24 notches of an octo with 3 harmonics, full update vs table lookup
+TEST(FilterUnittest, BenchmarkBiquadNotchTable)
+{
+    const int iterations = 20000;
+    const float looptimeS = NOTCH_BANK_TEST_LOOPTIME * 1e-6f;
+    static biquadNotchTable_t table;
+    biquadNotchTableInit(&table, 5.0f);
+    biquadNotchBank_t bank;
+    biquadNotchBankInit(&bank, NOTCH_BANK_TEST_SECTIONS);
+
+    const auto exactStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (int section = 0; section < NOTCH_BANK_TEST_SECTIONS; section++) {
+            biquadNotchBankUpdate(&bank, section, notchBankTestFrequency(section) + (i & 0xf), NOTCH_BANK_TEST_LOOPTIME, 5.0f, 1.0f);
+        }
+    }
+    const auto exactEnd = std::chrono::steady_clock::now();
+    const float exactB1 = bank.b1[NOTCH_BANK_TEST_SECTIONS - 1];
+
+    const auto tableStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (int section = 0; section < NOTCH_BANK_TEST_SECTIONS; section++) {
+            biquadNotchBankUpdateFromTable(&bank, section, &table, (notchBankTestFrequency(section) + (i & 0xf)) * looptimeS, 1.0f);
+        }
+    }
+    const auto tableEnd = std::chrono::steady_clock::now();
+
+    const double exactNs = std::chrono::duration<double, std::nano>(exactEnd - exactStart).count() / iterations;
+    const double tableNs = std::chrono::duration<double, std::nano>(tableEnd - tableStart).count() / iterations;
+    printf("[ BENCH    ] retune %d notches: full update %.0f ns/loop, table %.0f ns/loop\n",
+        NOTCH_BANK_TEST_SECTIONS, exactNs, tableNs);
+
+    EXPECT_NEAR(exactB1, bank.b1[NOTCH_BANK_TEST_SECTIONS - 1], 1e-3f);
+}
+
+// Fixed point filters, compared against the float path they replace
+
+#define FIXED_TEST_LOOPTIME_US 125      // 8kHz
+#define FIXED_TEST_SAMPLES 16000
+
+// Amplitude and phase of the response to a sine, from the correlation with sin and cos over the last half of the run
+typedef struct {
+    float amplitude;
+    float phase;
+} sineResponse_t;
+
+static sineResponse_t sineResponse(const float *output, float omega)
+{
+    double sinSum = 0, cosSum = 0;
+    for (int i = FIXED_TEST_SAMPLES / 2; i < FIXED_TEST_SAMPLES; i++) {
+        sinSum += output[i] * sin(omega * i);
+        cosSum += output[i] * cos(omega * i);
+    }
+    const double n = FIXED_TEST_SAMPLES / 2;
+    sineResponse_t response;
+    response.amplitude = 2 * sqrt(sinSum * sinSum + cosSum * cosSum) / n;
+    response.phase = atan2(cosSum, sinSum) * 180.0 / M_PI;
+    return response;
+}
+
+// Runs a float and a fixed point biquad with the same coefficients over a sine, compares gain and phase
+static void biquadFixedSineTest(const biquadFilterCoeffs_t *coeffs, float sineHz, float maxGainError, float maxPhaseError)
+{
+    static float floatOut[FIXED_TEST_SAMPLES];
+    static float fixedOut[FIXED_TEST_SAMPLES];
+
+    biquadFilterShared_t floatFilter;
+    biquadFilterSharedInit(&floatFilter, coeffs);
+    biquadFilterFixedCoeffs_t fixedCoeffs;
+    biquadFilterFixedCoeffsFromFloat(&fixedCoeffs, coeffs);
+    biquadFilterFixed_t fixedFilter;
+    biquadFilterFixedInit(&fixedFilter, &fixedCoeffs);
+
+    const float omega = 2 * M_PI * sineHz * FIXED_TEST_LOOPTIME_US * 1e-6f;
+    for (int i = 0; i < FIXED_TEST_SAMPLES; i++) {
+        const float sample = 500.0f * sinf(omega * i);
+        floatOut[i] = biquadFilterSharedApplyDF1(&floatFilter, sample);
+        fixedOut[i] = filterFixedToFloat(biquadFilterFixedApply(&fixedFilter, filterFixedFromFloat(sample)));
+    }
+
+    const sineResponse_t floatResponse = sineResponse(floatOut, omega);
+    const sineResponse_t fixedResponse = sineResponse(fixedOut, omega);
+    EXPECT_NEAR(floatResponse.amplitude, fixedResponse.amplitude, maxGainError * 500.0f);
+    if (floatResponse.amplitude > 1.0f) {
+        EXPECT_NEAR(floatResponse.phase, fixedResponse.phase, maxPhaseError);
+    }
+}
+
+TEST(FilterUnittest, TestFilterFixedConversion)
+{
+    EXPECT_EQ(1 << FILTER_FIXED_SAMPLE_SHIFT, filterFixedFromFloat(1.0f));
+    EXPECT_EQ(-2000 * (1 << FILTER_FIXED_SAMPLE_SHIFT), filterFixedFromFloat(-2000.0f));
+    EXPECT_FLOAT_EQ(1999.5f, filterFixedToFloat(filterFixedFromFloat(1999.5f)));
+}
+
+TEST(FilterUnittest, TestPt1FilterFixedMatchesFloat)
+{
+    pt1Filter_t floatFilter;
+    pt1FilterFixed_t fixedFilter;
+    const float k = pt1FilterGain(100.0f, FIXED_TEST_LOOPTIME_US * 1e-6f);
+    pt1FilterInit(&floatFilter, k);
+    pt1FilterFixedInit(&fixedFilter, k);
+
+    for (int i = 0; i < 2000; i++) {
+        const float sample = (i < 1000) ? 1800.0f : -1800.0f;
+        const float expected = pt1FilterApply(&floatFilter, sample);
+        EXPECT_NEAR(expected, filterFixedToFloat(pt1FilterFixedApply(&fixedFilter, filterFixedFromFloat(sample))), 0.01f);
+    }
+
+    // unity gain passes the input straight through
+    pt1FilterFixedInit(&fixedFilter, 1.0f);
+    EXPECT_NEAR(1000.0f, filterFixedToFloat(pt1FilterFixedApply(&fixedFilter, filterFixedFromFloat(1000.0f))), 0.001f);
+}
+
+TEST(FilterUnittest, TestPt2Pt3FilterFixedMatchesFloat)
+{
+    const float dT = FIXED_TEST_LOOPTIME_US * 1e-6f;
+    pt2Filter_t pt2;
+    pt2FilterFixed_t pt2Fixed;
+    pt3Filter_t pt3;
+    pt3FilterFixed_t pt3Fixed;
+    pt2FilterInit(&pt2, pt2FilterGain(150.0f, dT));
+    pt2FilterFixedInit(&pt2Fixed, pt2FilterGain(150.0f, dT));
+    pt3FilterInit(&pt3, pt3FilterGain(150.0f, dT));
+    pt3FilterFixedInit(&pt3Fixed, pt3FilterGain(150.0f, dT));
+
+    for (int i = 0; i < 4000; i++) {
+        const float sample = 700.0f * sinf(0.01f * i) + 50.0f * sinf(0.9f * i);
+        const int32_t fixedSample = filterFixedFromFloat(sample);
+        EXPECT_NEAR(pt2FilterApply(&pt2, sample), filterFixedToFloat(pt2FilterFixedApply(&pt2Fixed, fixedSample)), 0.01f);
+        EXPECT_NEAR(pt3FilterApply(&pt3, sample), filterFixedToFloat(pt3FilterFixedApply(&pt3Fixed, fixedSample)), 0.01f);
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterFixedLowpassGainAndPhase)
+{
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterCoeffsUpdateLPF(&coeffs, 100.0f, FIXED_TEST_LOOPTIME_US);
+
+    // pass band, cutoff and stop band
+    biquadFixedSineTest(&coeffs, 20.0f, 1e-4f, 0.01f);
+    biquadFixedSineTest(&coeffs, 100.0f, 1e-4f, 0.01f);
+    biquadFixedSineTest(&coeffs, 800.0f, 1e-4f, 0.05f);
+}
+
+TEST(FilterUnittest, TestBiquadFilterFixedNotchGainAndPhase)
+{
+    // low notch at a high sample rate is the worst case for coefficient quantisation
+    biquadFilterCoeffs_t coeffs;
+    biquadFilterCoeffsUpdate(&coeffs, 80.0f, FIXED_TEST_LOOPTIME_US, filterGetNotchQ(80.0f, 60.0f), FILTER_NOTCH, 1.0f);
+
+    biquadFixedSineTest(&coeffs, 30.0f, 1e-4f, 0.01f);
+    biquadFixedSineTest(&coeffs, 80.0f, 1e-4f, 1.0f);
+    biquadFixedSineTest(&coeffs, 300.0f, 1e-4f, 0.01f);
+}
+
+// double precision DF1 reference, float itself carries ~1e-3 dps of rounding noise through a low notch
+typedef struct biquadDoubleRef_s {
+    double x1, x2, y1, y2;
+} biquadDoubleRef_t;
+
+static double biquadDoubleRefApply(biquadDoubleRef_t *ref, const biquadFilterCoeffs_t *c, double input)
+{
+    const double result = (double)c->b0 * input + (double)c->b1 * ref->x1 + (double)c->b2 * ref->x2 - (double)c->a1 * ref->y1 - (double)c->a2 * ref->y2;
+    ref->x2 = ref->x1;
+    ref->x1 = input;
+    ref->y2 = ref->y1;
+    ref->y1 = result;
+    return result;
+}
+
+TEST(FilterUnittest, TestBiquadFilterFixedNoise)
+{
+    // white noise through a low notch and lowpass, the fixed point output must stay within ~0.001 dps rms of
+    // a double precision reference, and no further from it than the float path is
+    biquadFilterCoeffs_t notchCoeffs;
+    biquadFilterCoeffs_t lowpassCoeffs;
+    biquadFilterCoeffsUpdate(&notchCoeffs, 80.0f, FIXED_TEST_LOOPTIME_US, filterGetNotchQ(80.0f, 60.0f), FILTER_NOTCH, 1.0f);
+    biquadFilterCoeffsUpdateLPF(&lowpassCoeffs, 60.0f, FIXED_TEST_LOOPTIME_US);
+
+    biquadFilterShared_t notch, lowpass;
+    biquadFilterSharedInit(&notch, &notchCoeffs);
+    biquadFilterSharedInit(&lowpass, &lowpassCoeffs);
+
+    biquadFilterFixedCoeffs_t notchFixedCoeffs, lowpassFixedCoeffs;
+    biquadFilterFixedCoeffsFromFloat(&notchFixedCoeffs, &notchCoeffs);
+    biquadFilterFixedCoeffsFromFloat(&lowpassFixedCoeffs, &lowpassCoeffs);
+    biquadFilterFixed_t notchFixed, lowpassFixed;
+    biquadFilterFixedInit(&notchFixed, &notchFixedCoeffs);
+    biquadFilterFixedInit(&lowpassFixed, &lowpassFixedCoeffs);
+
+    biquadDoubleRef_t notchRef = {}, lowpassRef = {};
+
+    uint32_t seed = 12345;
+    double errorSquareSum = 0;
+    double floatErrorSquareSum = 0;
+    double signalSquareSum = 0;
+    for (int i = 0; i < FIXED_TEST_SAMPLES; i++) {
+        seed = seed * 1664525 + 1013904223;
+        const float sample = ((int32_t)seed >> 8) * (1000.0f / (1 << 23));
+        const float floatOut = biquadFilterSharedApplyDF1(&lowpass, biquadFilterSharedApplyDF1(&notch, sample));
+        const int32_t fixedOut = biquadFilterFixedApply(&lowpassFixed, biquadFilterFixedApply(&notchFixed, filterFixedFromFloat(sample)));
+        const double refOut = biquadDoubleRefApply(&lowpassRef, &lowpassCoeffs, biquadDoubleRefApply(&notchRef, &notchCoeffs, sample));
+        const double error = filterFixedToFloat(fixedOut) - refOut;
+        const double floatError = floatOut - refOut;
+        errorSquareSum += error * error;
+        floatErrorSquareSum += floatError * floatError;
+        signalSquareSum += refOut * refOut;
+    }
+    const double errorRms = sqrt(errorSquareSum / FIXED_TEST_SAMPLES);
+    const double floatErrorRms = sqrt(floatErrorSquareSum / FIXED_TEST_SAMPLES);
+    const double signalRms = sqrt(signalSquareSum / FIXED_TEST_SAMPLES);
+    printf("[ INFO     ] rms error vs double: fixed point %g, float %g\n", errorRms, floatErrorRms);
+
+    EXPECT_LT(errorRms, 1e-3);
+    EXPECT_LT(errorRms, floatErrorRms);
+    EXPECT_GT(signalRms, 10.0);
+}
+
+// Not a pass/fail test: float versus fixed point cost of the static gyro filters (two notches and a lowpass)
+TEST(FilterUnittest, BenchmarkBiquadFilterFixed)
+{
+    const int iterations = 200000;
+    biquadFilterCoeffs_t coeffs[3];
+    biquadFilterCoeffsUpdate(&coeffs[0], 200.0f, FIXED_TEST_LOOPTIME_US, 2.0f, FILTER_NOTCH, 1.0f);
+    biquadFilterCoeffsUpdate(&coeffs[1], 350.0f, FIXED_TEST_LOOPTIME_US, 2.0f, FILTER_NOTCH, 1.0f);
+    biquadFilterCoeffsUpdateLPF(&coeffs[2], 150.0f, FIXED_TEST_LOOPTIME_US);
+
+    biquadFilterShared_t floatFilter[3];
+    biquadFilterFixedCoeffs_t fixedCoeffs[3];
+    biquadFilterFixed_t fixedFilter[3];
+    for (int i = 0; i < 3; i++) {
+        biquadFilterSharedInit(&floatFilter[i], &coeffs[i]);
+        biquadFilterFixedCoeffsFromFloat(&fixedCoeffs[i], &coeffs[i]);
+        biquadFilterFixedInit(&fixedFilter[i], &fixedCoeffs[i]);
+    }
+
+    float floatSink = 0.0f;
+    const auto floatStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        float value = (float)((i * 37) & 0x3ff) - 512.0f;
+        for (int f = 0; f < 3; f++) {
+            value = biquadFilterSharedApplyDF1(&floatFilter[f], value);
+        }
+        floatSink += value;
+    }
+    const auto floatEnd = std::chrono::steady_clock::now();
+
+    int64_t fixedSink = 0;
+    const auto fixedStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        int32_t value = filterFixedFromFloat((float)((i * 37) & 0x3ff) - 512.0f);
+        for (int f = 0; f < 3; f++) {
+            value = biquadFilterFixedApply(&fixedFilter[f], value);
+        }
+        fixedSink += value;
+    }
+    const auto fixedEnd = std::chrono::steady_clock::now();
+
+    const double floatNs = std::chrono::duration<double, std::nano>(floatEnd - floatStart).count() / iterations;
+    const double fixedNs = std::chrono::duration<double, std::nano>(fixedEnd - fixedStart).count() / iterations;
+    printf("[ BENCH    ] 3 biquads: float %.1f ns/sample, fixed point %.1f ns/sample\n", floatNs, fixedNs);
+
+    EXPECT_TRUE(isfinite(floatSink));
+    EXPECT_NE(0, fixedSink);
+}
@@ -61,6 +61,12 @@ extern "C" {
     extern float rMat[3][3];
     extern bool attitudeIsEstablished;
 
+    void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
+                             bool useAcc, float ax, float ay, float az,
+                             bool useMag,
+                             bool useCOG, float courseOverGround, const float dcmKpGain,
+                             const float *deltaAngle);
+
     PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
     PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
 
@@ -199,6 +205,47 @@ TEST(FlightImuTest, TestSmallAngle)
     EXPECT_FALSE(isUpright());
 }
 
+TEST(FlightImuTest, TestDeltaAngleRotation)
+{
+    // given
+    imuConfigMutable()->dcm_ki = 0;
+    imuConfigure(0, 0);
+    q.w = 1.0f;
+    q.x = 0.0f;
+    q.y = 0.0f;
+    q.z = 0.0f;
+
+    // when
+    // 90 degrees about Z in one step is beyond the first order integration, but exact for the delta-angle
+    const float deltaAngle[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, M_PIf / 2.0f };
+    imuMahonyAHRSupdate(0.01f, 0.0f, 0.0f, M_PIf / 2.0f / 0.01f, false, 0.0f, 0.0f, 0.0f, false, false, 0.0f, 0.0f, deltaAngle);
+
+    // expect
+    EXPECT_NEAR(sqrt2over2, q.w, 1e-3);
+    EXPECT_NEAR(0.0f, q.x, 1e-6);
+    EXPECT_NEAR(0.0f, q.y, 1e-6);
+    EXPECT_NEAR(sqrt2over2, q.z, 1e-3);
+    EXPECT_NEAR(-1.0f, rMat[0][1], 1e-3);
+    EXPECT_NEAR(1.0f, rMat[1][0], 1e-3);
+
+    // when
+    // successive small steps about X then Y compose as rotations, not as a summed rate
+    q.w = 1.0f;
+    q.z = 0.0f;
+    const float rollStep[XYZ_AXIS_COUNT] = { 0.1f, 0.0f, 0.0f };
+    const float pitchStep[XYZ_AXIS_COUNT] = { 0.0f, 0.1f, 0.0f };
+    imuMahonyAHRSupdate(0.001f, 0.0f, 0.0f, 0.0f, false, 0.0f, 0.0f, 0.0f, false, false, 0.0f, 0.0f, rollStep);
+    imuMahonyAHRSupdate(0.001f, 0.0f, 0.0f, 0.0f, false, 0.0f, 0.0f, 0.0f, false, false, 0.0f, 0.0f, pitchStep);
+
+    // expect
+    const float c = cosf(0.05f);
+    const float sn = sinf(0.05f);
+    EXPECT_NEAR(c * c, q.w, 1e-6);
+    EXPECT_NEAR(sn * c, q.x, 1e-6);
+    EXPECT_NEAR(c * sn, q.y, 1e-6);
+    EXPECT_NEAR(sn * sn, q.z, 1e-6);
+}
+
 // STUBS
 
 extern "C" {
@@ -245,6 +292,7 @@ bool baroIsCalibrationComplete(void) { return true; }
 void performBaroCalibrationCycle(void) {}
 int32_t baroCalculateAltitude(void) { return 0; }
 bool gyroGetAccumulationAverage(float *) { return false; }
+bool gyroGetAccumulatedDeltaAngle(float *) { return false; }
 bool accGetAccumulationAverage(float *) { return false; }
 void mixerSetThrottleAngleCorrection(int) {};
 bool gpsRescueIsRunning(void) { return false; }
@@ -0,0 +1,120 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "common/axis.h"
+    #include "sensors/gyro_fusion.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FUSION_TEST_LOOPTIME 125
+#define FUSION_TEST_SAMPLES  8000
+
+// deterministic noise in [-1, 1]
+static float fusionTestNoise(uint32_t *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / (float)(1 << 23) - 1.0f;
+}
+
+static float fusionTestSignal(int i)
+{
+    return 100.0f * sinf(2.0f * M_PI * 3.0f * i * FUSION_TEST_LOOPTIME * 1e-6f);
+}
+
+TEST(GyroFusionUnittest, TestEqualNoiseAveragesSensors)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion, 200, FUSION_TEST_LOOPTIME);
+
+    uint32_t seed1 = 1, seed2 = 2;
+    for (int i = 0; i < FUSION_TEST_SAMPLES; i++) {
+        const float signal = fusionTestSignal(i);
+        gyroFusionApply(&fusion, X, signal + fusionTestNoise(&seed1), signal + fusionTestNoise(&seed2));
+    }
+
+    EXPECT_NEAR(0.5f, fusion.weight[X], 0.1f);
+    EXPECT_EQ(0u, fusion.sensor[0].rejectCount);
+    EXPECT_EQ(0u, fusion.sensor[1].rejectCount);
+}
+
+TEST(GyroFusionUnittest, TestNoisySensorIsWeightedDown)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion, 200, FUSION_TEST_LOOPTIME);
+
+    uint32_t seed1 = 1, seed2 = 2;
+    float errorSq1 = 0.0f;
+    float errorSqFused = 0.0f;
+    for (int i = 0; i < FUSION_TEST_SAMPLES; i++) {
+        const float signal = fusionTestSignal(i);
+        const float sample1 = signal + fusionTestNoise(&seed1);
+        const float sample2 = signal + 4.0f * fusionTestNoise(&seed2);
+        const float fused = gyroFusionApply(&fusion, X, sample1, sample2);
+        if (i > FUSION_TEST_SAMPLES / 2) {
+            errorSq1 += (sample1 - signal) * (sample1 - signal);
+            errorSqFused += (fused - signal) * (fused - signal);
+        }
+    }
+
+    // variances 1:16 give a weight of 16 / 17 to the quiet sensor
+    EXPECT_NEAR(16.0f / 17.0f, fusion.weight[X], 0.03f);
+    // and the fused noise is below the noise of the quiet sensor
+    EXPECT_LT(errorSqFused, errorSq1);
+}
+
+TEST(GyroFusionUnittest, TestOutlierIsRejected)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion, 200, FUSION_TEST_LOOPTIME);
+
+    uint32_t seed1 = 1, seed2 = 2;
+    for (int i = 0; i < FUSION_TEST_SAMPLES; i++) {
+        const float signal = fusionTestSignal(i);
+        float sample2 = signal + fusionTestNoise(&seed2);
+        if (i % 1000 == 500) {
+            sample2 = 2000.0f; // sensor 2 glitches to full scale
+        }
+        const float fused = gyroFusionApply(&fusion, Y, signal + fusionTestNoise(&seed1), sample2);
+        EXPECT_NEAR(signal, fused, 5.0f);
+    }
+
+    EXPECT_EQ(0u, fusion.sensor[0].rejectCount);
+    EXPECT_EQ(8u, fusion.sensor[1].rejectCount);
+}
+
+TEST(GyroFusionUnittest, TestOutlierRejectionDisabled)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion, 0, FUSION_TEST_LOOPTIME);
+
+    gyroFusionApply(&fusion, Z, 0.0f, 0.0f);
+    const float fused = gyroFusionApply(&fusion, Z, 0.0f, 1000.0f);
+
+    EXPECT_GT(fused, 0.0f);
+    EXPECT_EQ(0u, fusion.sensor[1].rejectCount);
+}
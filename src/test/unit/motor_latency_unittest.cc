@@ -0,0 +1,119 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "drivers/motor_latency.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    static uint32_t testCycles;
+
+    uint32_t getCycleCounter(void) { return testCycles; }
+    // one cycle per tenth of a microsecond keeps the expected values readable
+    int32_t clockCyclesTo10thMicros(int32_t clockCycles) { return clockCycles; }
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static void runLoop(uint32_t latencyUs10)
+{
+    motorLatencyMarkGyroSample();
+    testCycles += latencyUs10;
+    motorLatencyMarkOutput();
+    testCycles += 1000;
+}
+
+TEST(MotorLatencyUnittest, TestNothingRecordedWithoutDebugMode)
+{
+    debugMode = DEBUG_NONE;
+    motorLatencyReset();
+
+    runLoop(500);
+    motorLatencyMarkSkipped();
+
+    EXPECT_FALSE(motorLatencyIsEnabled());
+    EXPECT_EQ(0u, motorLatencyGetStats()->sampleCount);
+    EXPECT_EQ(0u, motorLatencyGetStats()->skippedUpdates);
+}
+
+TEST(MotorLatencyUnittest, TestStatistics)
+{
+    debugMode = DEBUG_MOTOR_LATENCY;
+    motorLatencyReset();
+
+    runLoop(450);     // 45us
+    runLoop(150);     // 15us
+    runLoop(3000);    // 300us, beyond the last bucket
+
+    const motorLatencyStats_t *stats = motorLatencyGetStats();
+    EXPECT_EQ(3u, stats->sampleCount);
+    EXPECT_EQ(150u, stats->minUs10);
+    EXPECT_EQ(3000u, stats->maxUs10);
+    EXPECT_EQ(3000u, stats->lastUs10);
+    EXPECT_EQ(1200u, motorLatencyAverageUs10());
+    EXPECT_EQ(1u, stats->histogram[4]);
+    EXPECT_EQ(1u, stats->histogram[1]);
+    EXPECT_EQ(1u, stats->histogram[MOTOR_LATENCY_BUCKET_COUNT - 1]);
+
+    EXPECT_EQ(3000, debug[0]);
+    EXPECT_EQ(150, debug[1]);
+    EXPECT_EQ(3000, debug[2]);
+    EXPECT_EQ(1200, debug[3]);
+}
+
+TEST(MotorLatencyUnittest, TestOutputWithoutNewGyroSampleIsNotCounted)
+{
+    debugMode = DEBUG_MOTOR_LATENCY;
+    motorLatencyReset();
+
+    runLoop(200);
+    motorLatencyMarkOutput();
+
+    EXPECT_EQ(1u, motorLatencyGetStats()->sampleCount);
+}
+
+TEST(MotorLatencyUnittest, TestSkippedUpdateCountsFromTheOriginalSample)
+{
+    debugMode = DEBUG_MOTOR_LATENCY;
+    motorLatencyReset();
+
+    // the sample whose motor update was skipped reaches the motors a loop later
+    motorLatencyMarkGyroSample();
+    testCycles += 300;
+    motorLatencyMarkSkipped();
+    testCycles += 1250;
+    motorLatencyMarkOutput();
+
+    const motorLatencyStats_t *stats = motorLatencyGetStats();
+    EXPECT_EQ(1u, stats->skippedUpdates);
+    EXPECT_EQ(1u, stats->sampleCount);
+    EXPECT_EQ(1550u, stats->maxUs10);
+}
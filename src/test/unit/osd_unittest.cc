@@ -1343,6 +1343,15 @@ extern "C" {
         return false;
     }
 
+    uint32_t blackboxGetDroppedFrameCount() {
+        return 0;
+    }
+
+    const blackboxStats_t *blackboxGetStats() {
+        static blackboxStats_t stats;
+        return &stats;
+    }
+
     bool isSerialTransmitBufferEmpty(const serialPort_t *) {
         return false;
     }
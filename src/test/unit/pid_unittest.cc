@@ -19,6 +19,7 @@
 #include <stdbool.h>
 #include <limits.h>
 #include <cmath>
+#include <chrono>
 
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
@@ -825,3 +826,98 @@ TEST(pidControllerTest, testLaunchControl) {
     EXPECT_NEAR(44.84,  pidData[FD_YAW].P,   calculateTolerance(44.84));
     EXPECT_NEAR(1.56,   pidData[FD_YAW].I,  calculateTolerance(1.56));
 }
+
+typedef void (*pidControllerFn)(const pidProfile_t *, timeUs_t);
+
+static void runVariantSequence(pidControllerFn controller, flightModeFlags_e modes, bool launchControl, pidAxisData_t *result)
+{
+    resetTest();
+    enableFlightMode(modes);
+    unitLaunchControlActive = launchControl;
+    ENABLE_ARMING_FLAG(ARMED);
+    pidStabilisationState(PID_STABILISATION_ON);
+
+    for (int loop = 0; loop < 50; loop++) {
+        setStickPosition(FD_ROLL, (loop % 10) / 10.0f);
+        setStickPosition(FD_PITCH, -(loop % 7) / 10.0f);
+        gyro.gyroADCf[FD_ROLL] = loop * 3.0f;
+        gyro.gyroADCf[FD_PITCH] = -loop * 2.0f;
+        gyro.gyroADCf[FD_YAW] = (loop % 5) * 4.0f;
+        controller(pidProfile, currentTestTime());
+    }
+    memcpy(result, pidData, sizeof(pidData));
+}
+
+static void expectVariantMatchesFull(pidControllerFn controller, flightModeFlags_e modes, bool launchControl)
+{
+    pidAxisData_t full[XYZ_AXIS_COUNT];
+    pidAxisData_t variant[XYZ_AXIS_COUNT];
+
+    runVariantSequence(pidControllerFull, modes, launchControl, full);
+    runVariantSequence(controller, modes, launchControl, variant);
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        EXPECT_FLOAT_EQ(full[axis].P, variant[axis].P);
+        EXPECT_FLOAT_EQ(full[axis].I, variant[axis].I);
+        EXPECT_FLOAT_EQ(full[axis].D, variant[axis].D);
+        EXPECT_FLOAT_EQ(full[axis].F, variant[axis].F);
+        EXPECT_FLOAT_EQ(full[axis].Sum, variant[axis].Sum);
+    }
+}
+
+TEST(pidControllerTest, testVariantsMatchFullController) {
+    // with no mode active every variant has to produce what the full controller does
+    expectVariantMatchesFull(pidControllerAcro, (flightModeFlags_e)0, false);
+    expectVariantMatchesFull(pidControllerLevel, (flightModeFlags_e)0, false);
+    expectVariantMatchesFull(pidControllerLaunch, (flightModeFlags_e)0, false);
+    expectVariantMatchesFull(pidController, (flightModeFlags_e)0, false);
+
+    // and each specialised variant covers its own mode
+    expectVariantMatchesFull(pidControllerLevel, ANGLE_MODE, false);
+    expectVariantMatchesFull(pidControllerLevel, HORIZON_MODE, false);
+    expectVariantMatchesFull(pidControllerLaunch, (flightModeFlags_e)0, true);
+
+    // the dispatcher has to pick a variant that covers the active modes
+    expectVariantMatchesFull(pidController, ANGLE_MODE, false);
+    expectVariantMatchesFull(pidController, (flightModeFlags_e)0, true);
+}
+
+// Not a pass/fail test: host time per pidController() call for each variant, absolute numbers are only
+// meaningful relative to each other on the same host.
+TEST(pidControllerTest, BenchmarkControllerVariants) {
+    const int iterations = 20000;
+    const struct {
+        const char *name;
+        pidControllerFn controller;
+        flightModeFlags_e modes;
+        bool launchControl;
+    } cases[] = {
+        { "acro",     pidControllerAcro,   (flightModeFlags_e)0, false },
+        { "level",    pidControllerLevel,  ANGLE_MODE,           false },
+        { "launch",   pidControllerLaunch, (flightModeFlags_e)0, true },
+        { "full",     pidControllerFull,   (flightModeFlags_e)0, false },
+        { "dispatch", pidController,       (flightModeFlags_e)0, false },
+    };
+
+    float sink = 0.0f;
+    for (const auto &c : cases) {
+        resetTest();
+        enableFlightMode(c.modes);
+        unitLaunchControlActive = c.launchControl;
+        ENABLE_ARMING_FLAG(ARMED);
+        pidStabilisationState(PID_STABILISATION_ON);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            gyro.gyroADCf[FD_ROLL] = (i & 0xff) - 128.0f;
+            gyro.gyroADCf[FD_PITCH] = (i & 0x7f) - 64.0f;
+            c.controller(pidProfile, currentTestTime());
+            sink += pidData[FD_ROLL].Sum;
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+        printf("[ BENCH    ] pidController %-8s %.0f ns/iteration\n", c.name, ns);
+    }
+
+    EXPECT_TRUE(std::isfinite(sink));
+}
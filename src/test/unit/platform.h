@@ -27,6 +27,7 @@
 #define U_ID_2 2
 
 #define NOINLINE
+#define ALWAYS_INLINE inline __attribute__((always_inline))
 #define FAST_CODE
 #define FAST_CODE_NOINLINE
 #define FAST_DATA_ZERO_INIT
@@ -0,0 +1,141 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/time.h"
+
+    #include "scheduler/scheduler.h"
+    #include "scheduler/scheduler_trace.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static void recordTasks(unsigned count, uint32_t firstCycles)
+{
+    for (unsigned i = 0; i < count; i++) {
+        const uint32_t startCycles = firstCycles + i * 100;
+        schedulerTraceRecord((i & 1) ? TASK_RX : TASK_GYRO, startCycles, startCycles + 25, i, (i & 1) ? 0 : SCHEDULER_TRACE_FLAG_REALTIME);
+    }
+}
+
+TEST(SchedulerTraceUnittest, TestStoppedTraceRecordsNothing)
+{
+    schedulerTraceStart(SCHEDULER_TRACE_RUNNING);
+    schedulerTraceStop();
+    recordTasks(3, 0);
+
+    EXPECT_EQ(SCHEDULER_TRACE_STOPPED, schedulerTraceGetState());
+    EXPECT_EQ(0u, schedulerTraceCount());
+}
+
+TEST(SchedulerTraceUnittest, TestRingKeepsNewestEntries)
+{
+    schedulerTraceStart(SCHEDULER_TRACE_RUNNING);
+    recordTasks(SCHEDULER_TRACE_SIZE + 3, 1000);
+
+    EXPECT_EQ((unsigned)SCHEDULER_TRACE_SIZE, schedulerTraceCount());
+
+    schedulerTraceEntry_t entry;
+    for (unsigned i = 0; i < SCHEDULER_TRACE_SIZE; i++) {
+        ASSERT_TRUE(schedulerTraceGet(i, &entry));
+        EXPECT_EQ(1000u + (i + 3) * 100, entry.startCycles);
+        EXPECT_EQ(i + 3, entry.checkCycles);
+    }
+    EXPECT_FALSE(schedulerTraceGet(SCHEDULER_TRACE_SIZE, &entry));
+}
+
+TEST(SchedulerTraceUnittest, TestCheckCyclesSaturate)
+{
+    schedulerTraceStart(SCHEDULER_TRACE_RUNNING);
+    schedulerTraceRecord(TASK_RX, 0, 10, 100000, 0);
+
+    schedulerTraceEntry_t entry;
+    ASSERT_TRUE(schedulerTraceGet(0, &entry));
+    EXPECT_EQ(UINT16_MAX, entry.checkCycles);
+}
+
+TEST(SchedulerTraceUnittest, TestArmedTraceStopsAfterLateTask)
+{
+    schedulerTraceStart(SCHEDULER_TRACE_ARMED_LATE);
+    recordTasks(5, 0);
+    EXPECT_EQ(SCHEDULER_TRACE_ARMED_LATE, schedulerTraceGetState());
+
+    schedulerTraceMarkLast(SCHEDULER_TRACE_FLAG_LATE);
+    recordTasks(SCHEDULER_TRACE_SIZE / 2 - 1, 10000);
+    EXPECT_EQ(SCHEDULER_TRACE_ARMED_LATE, schedulerTraceGetState());
+    recordTasks(1, 20000);
+    EXPECT_EQ(SCHEDULER_TRACE_STOPPED, schedulerTraceGetState());
+
+    // the late task is in the middle of the ring, and later entries are discarded
+    recordTasks(3, 30000);
+    schedulerTraceEntry_t entry;
+    ASSERT_TRUE(schedulerTraceGet(SCHEDULER_TRACE_SIZE / 2 - 1, &entry));
+    EXPECT_TRUE(entry.flags & SCHEDULER_TRACE_FLAG_LATE);
+    ASSERT_TRUE(schedulerTraceGet(SCHEDULER_TRACE_SIZE - 1, &entry));
+    EXPECT_EQ(20000u, entry.startCycles);
+}
+
+TEST(SchedulerTraceUnittest, TestChromeTraceEvents)
+{
+    char buf[SCHEDULER_TRACE_EVENT_LENGTH];
+    schedulerTraceEntry_t entry = { .startCycles = 0xfffffff0, .endCycles = 0x10, .checkCycles = 3, .taskId = TASK_GYRO, .flags = SCHEDULER_TRACE_FLAG_REALTIME };
+
+    // times are relative to the base and survive the cycle counter wrapping
+    schedulerTraceFormatEvent(buf, &entry, 0xffffffe0);
+    EXPECT_STREQ("{\"name\":\"GYRO\",\"ph\":\"X\",\"ts\":1.6,\"dur\":3.2,\"pid\":1,\"tid\":1,\"args\":{\"check\":0.3}}", buf);
+
+    entry.taskId = TASK_RX;
+    entry.flags = SCHEDULER_TRACE_FLAG_LATE;
+    schedulerTraceFormatEvent(buf, &entry, 0xfffffff0);
+    EXPECT_STREQ("{\"name\":\"RX\",\"ph\":\"X\",\"ts\":0.0,\"dur\":3.2,\"pid\":1,\"tid\":2,\"cname\":\"terrible\",\"args\":{\"check\":0.3}}", buf);
+
+    entry.flags = SCHEDULER_TRACE_FLAG_EXPEDITED;
+    schedulerTraceFormatEvent(buf, &entry, 0xffffffe0);
+    EXPECT_STREQ("{\"name\":\"RX expedited\",\"ph\":\"i\",\"s\":\"t\",\"ts\":1.6,\"pid\":1,\"tid\":2}", buf);
+}
+
+// STUBS
+
+extern "C" {
+    static task_attribute_t gyroAttribute = { "GYRO", NULL, NULL, NULL, 0, TASK_PRIORITY_REALTIME };
+    static task_attribute_t rxAttribute = { "RX", NULL, NULL, NULL, 0, TASK_PRIORITY_HIGH };
+    static task_t testTasks[TASK_COUNT];
+
+    task_t *getTask(unsigned taskId)
+    {
+        testTasks[TASK_GYRO].attribute = &gyroAttribute;
+        testTasks[TASK_RX].attribute = &rxAttribute;
+        return &testTasks[taskId];
+    }
+
+    // 10 cycles per us
+    int32_t clockCyclesTo10thMicros(int32_t clockCycles)
+    {
+        return clockCycles;
+    }
+}
@@ -16,9 +16,12 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
 
 extern "C" {
     #include "platform.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
     #include "pg/pg.h"
     #include "pg/pg_ids.h"
     #include "pg/scheduler.h"
@@ -78,6 +81,13 @@ extern "C" {
     uint32_t clockMicrosToCycles(uint32_t x) { return x*10;}
     uint32_t getCycleCounter(void) {return simulatedTime * 10;}
 
+    // event driven task state, used by the synthetic load tests
+    bool rxFramePending = false;
+    bool osdUpdatePending = false;
+    uint32_t rxFrameAtUs = 0;
+    int32_t rxMaxLatencyUs = 0;
+    int rxFramesHandled = 0;
+
     // set up tasks to take a simulated representative time to execute
     bool gyroFilterReady(void) { return taskFilterReady; }
     bool pidLoopReady(void) { return taskPidReady; }
@@ -89,11 +99,18 @@ extern "C" {
     void taskUpdateAccelerometer(timeUs_t) { simulatedTime += TEST_UPDATE_ACCEL_TIME; }
     void taskHandleSerial(timeUs_t) { simulatedTime += TEST_HANDLE_SERIAL_TIME; }
     void taskUpdateBatteryVoltage(timeUs_t) { simulatedTime += TEST_UPDATE_BATTERY_TIME; }
-    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; return false; }
-    void taskUpdateRxMain(timeUs_t) { simulatedTime += TEST_UPDATE_RX_MAIN_TIME; }
+    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; return rxFramePending; }
+    void taskUpdateRxMain(timeUs_t) {
+        simulatedTime += TEST_UPDATE_RX_MAIN_TIME;
+        if (rxFramePending) {
+            rxMaxLatencyUs = MAX(rxMaxLatencyUs, (int32_t)(simulatedTime - rxFrameAtUs));
+            rxFramesHandled++;
+            rxFramePending = false;
+        }
+    }
     void imuUpdateAttitude(timeUs_t) { simulatedTime += TEST_IMU_UPDATE_TIME; }
     void dispatchProcess(timeUs_t) { simulatedTime += TEST_DISPATCH_TIME; }
-    bool osdUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_OSD_CHECK_TIME; return false; }
+    bool osdUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_OSD_CHECK_TIME; return osdUpdatePending; }
     void osdUpdate(timeUs_t) { simulatedTime += TEST_UPDATE_OSD_TIME; }
 
     void resetGyroTaskTestFlags(void) {
@@ -628,3 +645,167 @@ TEST(SchedulerUnittest, TestGyroTask)
     EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
 }
 
+
+#ifdef USE_SCHEDULER_EDF
+TEST(SchedulerUnittest, TestEdfEarliestDeadlineFirst)
+{
+    schedulerConfigMutable()->mode = SCHEDULER_MODE_EDF;
+    schedulerInit();
+
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_ATTITUDE, true);
+
+    // keep the next gyro cycle a full period away
+    simulatedTime = 100000;
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+
+    // TASK_ACCEL has just been released, its deadline is 1000us away.
+    // TASK_ATTITUDE was released 9500us ago, so its deadline is only 500us away
+    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    tasks[TASK_ATTITUDE].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(100) - 9500;
+    tasks[TASK_ACCEL].anticipatedExecutionTime = TEST_UPDATE_ACCEL_TIME << TASK_EXEC_TIME_SHIFT;
+    tasks[TASK_ATTITUDE].anticipatedExecutionTime = TEST_UPDATE_ATTITUDE_TIME << TASK_EXEC_TIME_SHIFT;
+
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ATTITUDE], unittest_scheduler_selectedTask);
+
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    // nothing has been released
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    scheduler();
+    EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
+}
+
+TEST(SchedulerUnittest, TestEdfSkipsTasksThatDoNotFit)
+{
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_DISPATCH, true);
+
+    simulatedTime = 200000;
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+
+    // TASK_DISPATCH is the more urgent, but can't complete before the next gyro cycle
+    tasks[TASK_DISPATCH].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000) - 500;
+    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    tasks[TASK_DISPATCH].anticipatedExecutionTime = TEST_DISPATCH_TIME << TASK_EXEC_TIME_SHIFT;
+
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+    EXPECT_EQ(200000 + TEST_UPDATE_ACCEL_TIME, simulatedTime);
+
+    // with nothing else ready TASK_DISPATCH is selected, doesn't run, and once it has missed its deadline
+    // its anticipated execution time is reduced until it can be scheduled
+    const timeUs_t anticipatedExecutionTime = tasks[TASK_DISPATCH].anticipatedExecutionTime;
+    simulatedTime += 600;
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    const uint32_t startTime = simulatedTime;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_DISPATCH], unittest_scheduler_selectedTask);
+    EXPECT_EQ(startTime, simulatedTime);
+    EXPECT_LT(tasks[TASK_DISPATCH].anticipatedExecutionTime, anticipatedExecutionTime);
+}
+
+// Not a pass/fail test beyond basic bounds: run a synthetic load under both scheduling modes and report
+// the worst case RX latency and gyro cycle lateness
+static void runSyntheticLoad(schedulerMode_e mode, int32_t *gyroMaxLateUs, int *gyroLateCount)
+{
+    const uint32_t rxFramePeriodUs = 2000;
+    const uint32_t durationUs = 1000000;
+
+    schedulerConfigMutable()->mode = mode;
+    schedulerInit();
+
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), false);
+        schedulerResetTaskStatistics(static_cast<taskId_e>(taskId));
+        tasks[taskId].dynamicPriority = 0;
+        tasks[taskId].taskAgePeriods = 0;
+    }
+    const taskId_e loadTasks[] = { TASK_SYSTEM, TASK_GYRO, TASK_ACCEL, TASK_ATTITUDE, TASK_RX, TASK_SERIAL, TASK_BATTERY_VOLTAGE, TASK_OSD };
+    for (unsigned i = 0; i < ARRAYLEN(loadTasks); i++) {
+        setTaskEnabled(loadTasks[i], true);
+    }
+
+    simulatedTime = 1000000;
+    const uint32_t startTime = simulatedTime;
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        tasks[taskId].lastExecutedAtUs = simulatedTime;
+        tasks[taskId].lastStatsAtUs = simulatedTime;
+    }
+
+    resetGyroTaskTestFlags();
+    rxFramePending = false;
+    osdUpdatePending = true;    // heavy OSD load, always has work to do
+    rxMaxLatencyUs = 0;
+    rxFramesHandled = 0;
+    *gyroMaxLateUs = 0;
+    *gyroLateCount = 0;
+
+    uint32_t nextRxFrameUs = startTime + rxFramePeriodUs;
+    int rxFrames = 0;
+    int gyroCycles = 0;
+
+    while (simulatedTime - startTime < durationUs) {
+        if ((int32_t)(simulatedTime - nextRxFrameUs) >= 0) {
+            rxFramePending = true;
+            rxFrameAtUs = nextRxFrameUs;
+            nextRxFrameUs += rxFramePeriodUs;
+            rxFrames++;
+        }
+
+        const uint32_t gyroDueUs = tasks[TASK_GYRO].lastExecutedAtUs + TASK_PERIOD_HZ(TEST_GYRO_SAMPLE_HZ);
+        const uint32_t loopStartUs = simulatedTime;
+        // filtering every gyro cycle and the PID loop every other one
+        taskFilterReady = true;
+        taskPidReady = (gyroCycles & 1);
+        taskGyroRan = false;
+        scheduler();
+        if (taskGyroRan) {
+            gyroCycles++;
+            const int32_t lateUs = tasks[TASK_GYRO].lastExecutedAtUs - gyroDueUs;
+            *gyroMaxLateUs = MAX(*gyroMaxLateUs, lateUs);
+            // the simulation steps in 1us when idle
+            if (lateUs > 1) {
+                (*gyroLateCount)++;
+            }
+        }
+        if (simulatedTime == loopStartUs) {
+            simulatedTime++;
+        }
+    }
+
+    // no frame may be overwritten before the RX task has processed it
+    EXPECT_GE(rxFramesHandled + 1, rxFrames);
+}
+
+TEST(SchedulerUnittest, BenchmarkEdfSyntheticLoad)
+{
+    schedulerEnableGyro();
+
+    int32_t priorityGyroMaxLateUs, edfGyroMaxLateUs;
+    int priorityGyroLateCount, edfGyroLateCount;
+
+    runSyntheticLoad(SCHEDULER_MODE_PRIORITY, &priorityGyroMaxLateUs, &priorityGyroLateCount);
+    const int32_t priorityRxMaxLatencyUs = rxMaxLatencyUs;
+
+    runSyntheticLoad(SCHEDULER_MODE_EDF, &edfGyroMaxLateUs, &edfGyroLateCount);
+    const int32_t edfRxMaxLatencyUs = rxMaxLatencyUs;
+
+    printf("[ BENCH    ] priority: rx max latency %dus, gyro late %d times, max %dus\n", priorityRxMaxLatencyUs, priorityGyroLateCount, priorityGyroMaxLateUs);
+    printf("[ BENCH    ] edf:      rx max latency %dus, gyro late %d times, max %dus\n", edfRxMaxLatencyUs, edfGyroLateCount, edfGyroMaxLateUs);
+
+    // EDF bounds the RX latency by the task period
+    EXPECT_LE(edfRxMaxLatencyUs, tasks[TASK_RX].attribute->desiredPeriodUs);
+
+    schedulerConfigMutable()->mode = SCHEDULER_MODE_PRIORITY;
+}
+#endif
@@ -0,0 +1,80 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    // mirrors sdftSize_e in common/sdft.h, which can't be included from C++
+    enum { SDFT_SIZE_48, SDFT_SIZE_72, SDFT_SIZE_96, SDFT_SIZE_128, SDFT_SIZE_COUNT };
+
+    int sdftSampleSize(const int size);
+    int sdftBinCount(const int size);
+
+    int testSdftPeakBin_C(const int size, const float normalisedFreq);
+    float testSdftBatchError_C(const int size, const int startBin, const int endBin, const int numBatches);
+    float testSdftAxesError_C(const int size, const int startBin, const int endBin, const int numBatches);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(SdftUnittest, TestSizes)
+{
+    EXPECT_EQ(48, sdftSampleSize(SDFT_SIZE_48));
+    EXPECT_EQ(72, sdftSampleSize(SDFT_SIZE_72));
+    EXPECT_EQ(96, sdftSampleSize(SDFT_SIZE_96));
+    EXPECT_EQ(128, sdftSampleSize(SDFT_SIZE_128));
+    EXPECT_EQ(64, sdftBinCount(SDFT_SIZE_128));
+
+    // invalid sizes fall back to the default
+    EXPECT_EQ(72, sdftSampleSize(SDFT_SIZE_COUNT));
+}
+
+TEST(SdftUnittest, TestPeakBinScalesWithSize)
+{
+    for (int size = 0; size < SDFT_SIZE_COUNT; size++) {
+        const int sampleSize = sdftSampleSize(size);
+        // a sine centred on bin 10 of every size
+        EXPECT_EQ(10, testSdftPeakBin_C(size, 10.0f / sampleSize));
+    }
+}
+
+TEST(SdftUnittest, TestPushBatchOnlyCoversActiveRange)
+{
+    for (int size = 0; size < SDFT_SIZE_COUNT; size++) {
+        const int binCount = sdftBinCount(size);
+        for (int numBatches = 1; numBatches <= 7; numBatches++) {
+            EXPECT_LT(testSdftBatchError_C(size, 2, binCount - 1, numBatches), 1e-3f);
+            EXPECT_LT(testSdftBatchError_C(size, binCount / 3, binCount / 2, numBatches), 1e-3f);
+        }
+    }
+}
+
+TEST(SdftUnittest, TestAxesMatchesSingleAxis)
+{
+    for (int size = 0; size < SDFT_SIZE_COUNT; size++) {
+        const int binCount = sdftBinCount(size);
+        EXPECT_LT(testSdftAxesError_C(size, 2, binCount - 1, 6), 1e-2f);
+        EXPECT_LT(testSdftAxesError_C(size, binCount / 4, binCount / 2, 3), 1e-2f);
+    }
+}
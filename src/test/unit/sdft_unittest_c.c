@@ -0,0 +1,110 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// complex_t is a C99 type, so the SDFT is driven from C and the tests only see plain floats
+
+#include <math.h>
+
+#include "common/maths.h"
+#include "common/sdft.h"
+
+static sdft_t sdftA;
+static sdft_t sdftB;
+static sdftAxes_t sdftAxes;
+static float output[SDFT_BIN_COUNT_MAX];
+static float outputAxes[XYZ_AXIS_COUNT][SDFT_BIN_COUNT_MAX];
+
+static float testSample(const int i, const float normalisedFreq)
+{
+    return sinf(2.0f * M_PIf * normalisedFreq * i) + 0.3f * sinf(2.0f * M_PIf * 0.37f * i);
+}
+
+// Returns the bin with the highest windowed power for a sine at normalisedFreq (cycles per sample)
+int testSdftPeakBin_C(const int size, const float normalisedFreq)
+{
+    const int binCount = sdftBinCount(size);
+
+    sdftInit(&sdftA, size, 1, binCount - 1, 1);
+    for (int i = 0; i < 4 * sdftSampleSize(size); i++) {
+        sdftPush(&sdftA, testSample(i, normalisedFreq));
+    }
+
+    sdftWinSq(&sdftA, output);
+
+    int peakBin = 0;
+    for (int bin = sdftA.startBin + 1; bin < sdftA.endBin; bin++) {
+        if (peakBin == 0 || output[bin] > output[peakBin]) {
+            peakBin = bin;
+        }
+    }
+    return peakBin;
+}
+
+// Returns the largest difference between whole-sample and batched updates, bins outside the range must stay untouched
+float testSdftBatchError_C(const int size, const int startBin, const int endBin, const int numBatches)
+{
+    sdftInit(&sdftA, size, startBin, endBin, 1);
+    sdftInit(&sdftB, size, startBin, endBin, numBatches);
+
+    for (int i = 0; i < 3 * sdftSampleSize(size); i++) {
+        const float sample = testSample(i, 0.1f);
+        sdftPush(&sdftA, sample);
+        for (int batch = 0; batch < numBatches; batch++) {
+            sdftPushBatch(&sdftB, sample, batch);
+        }
+    }
+
+    float maxError = 0.0f;
+    for (int bin = 0; bin < SDFT_BIN_COUNT_MAX; bin++) {
+        maxError = MAX(maxError, cabsf(sdftA.data[bin] - sdftB.data[bin]));
+    }
+    return maxError;
+}
+
+// Returns the largest difference between the interleaved all-axes SDFT and three single-axis SDFTs
+float testSdftAxesError_C(const int size, const int startBin, const int endBin, const int numBatches)
+{
+    float maxError = 0.0f;
+
+    sdftAxesInit(&sdftAxes, size, startBin, endBin, numBatches);
+    for (int i = 0; i < 3 * sdftSampleSize(size); i++) {
+        const float samples[XYZ_AXIS_COUNT] = { testSample(i, 0.1f), testSample(i, 0.2f), testSample(i, 0.3f) };
+        for (int batch = 0; batch < numBatches; batch++) {
+            sdftAxesPushBatch(&sdftAxes, samples, batch);
+        }
+    }
+    sdftAxesWinSq(&sdftAxes, outputAxes);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const float freq = 0.1f * (axis + 1);
+        sdftInit(&sdftA, size, startBin, endBin, numBatches);
+        for (int i = 0; i < 3 * sdftSampleSize(size); i++) {
+            for (int batch = 0; batch < numBatches; batch++) {
+                sdftPushBatch(&sdftA, testSample(i, freq), batch);
+            }
+        }
+        sdftWinSq(&sdftA, output);
+
+        for (int bin = sdftA.startBin + 1; bin < sdftA.endBin; bin++) {
+            maxError = MAX(maxError, fabsf(output[bin] - outputAxes[axis][bin]));
+        }
+    }
+    return maxError;
+}